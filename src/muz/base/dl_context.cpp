@@ -216,6 +216,8 @@ namespace datalog {
         m_bind_variables(m),
         m_rule_set(*this),
         m_transformed_rule_set(*this),
+        m_simplified_rules_trail(m_rule_manager),
+        m_simplified_rules_hits(0),
         m_rule_fmls_head(0),
         m_rule_fmls(m),
         m_background(m),
@@ -249,6 +251,8 @@ namespace datalog {
         m_preds.reset();
         m_preds_by_name.reset();
         reset_dealloc_values(m_sorts);
+        m_simplified_rules.reset();
+        m_simplified_rules_trail.reset();
         m_engine = nullptr;
         m_rel = nullptr;
     }
@@ -738,6 +742,52 @@ namespace datalog {
         m_generate_proof_trace = m_params->generate_proof_trace();
         m_unbound_compressor = m_params->datalog_unbound_compressor();
         m_default_relation = m_params->datalog_default_relation();
+        // simplification results depend on parameters.
+        m_simplified_rules.reset();
+        m_simplified_rules_trail.reset();
+    }
+
+    bool context::find_simplified_rule(rule* r, rule*& result) {
+        simplified_rule s;
+        if (!m_simplified_rules.find(r, s) || !s.m_done) {
+            return false;
+        }
+        ++m_simplified_rules_hits;
+        result = s.m_result;
+        return true;
+    }
+
+    void context::insert_simplified_rule(rule* r, rule* result) {
+        // only rules of the rule set seen at the start of the query are cached.
+        obj_map<rule, simplified_rule>::obj_map_entry* e = m_simplified_rules.find_core(r);
+        if (!e || e->get_data().m_value.m_done) {
+            return;
+        }
+        e->get_data().m_value.m_done = true;
+        e->get_data().m_value.m_result = result;
+        if (result) m_simplified_rules_trail.push_back(result);
+    }
+
+    /**
+       \brief Restrict the simplification cache to the rules of the current rule set.
+       Entries of rules that were replaced or removed are dropped.
+    */
+    void context::sync_simplified_rules() {
+        vector<std::pair<rule*, simplified_rule> > entries;
+        rule_ref_vector trail(m_rule_manager);
+        for (rule* r : m_rule_set) {
+            simplified_rule s;
+            m_simplified_rules.find(r, s);
+            entries.push_back(std::make_pair(r, s));
+            trail.push_back(r);
+            if (s.m_result) trail.push_back(s.m_result);
+        }
+        m_simplified_rules.reset();
+        for (auto const& kv : entries) {
+            m_simplified_rules.insert(kv.first, kv.second);
+        }
+        m_simplified_rules_trail.reset();
+        m_simplified_rules_trail.append(trail);
     }
 
     expr_ref context::get_background_assertion() {
@@ -853,6 +903,7 @@ namespace datalog {
         default:
             UNREACHABLE();
         }
+        sync_simplified_rules();
         ensure_engine();
         return m_engine->query(query);
     }
@@ -874,6 +925,7 @@ namespace datalog {
         default:
             UNREACHABLE();
         }
+        sync_simplified_rules();
         ensure_engine();
         return m_engine->query_from_lvl (query, lvl);
     }
@@ -978,12 +1030,14 @@ namespace datalog {
         if (m_engine) {
             m_engine->reset_statistics();
         }
+        m_simplified_rules_hits = 0;
     }
 
     void context::collect_statistics(statistics& st) const {
         if (m_engine) {
             m_engine->collect_statistics(st);
         }
+        st.update("dl simplified rules cache hits", m_simplified_rules_hits);
         get_memory_statistics(st);
         get_rlimit_statistics(m.limit(), st);
     }
@@ -190,6 +190,14 @@ namespace datalog {
         pred2syms          m_argument_var_names;
         rule_set           m_rule_set;
         rule_set           m_transformed_rule_set;
+        struct simplified_rule {
+            bool   m_done;
+            rule * m_result; // nullptr if the rule is redundant
+            simplified_rule(): m_done(false), m_result(nullptr) {}
+        };
+        obj_map<rule, simplified_rule> m_simplified_rules;
+        rule_ref_vector    m_simplified_rules_trail;
+        unsigned           m_simplified_rules_hits;
         expr_free_vars     m_free_vars;
         unsigned           m_rule_fmls_head;
         expr_ref_vector    m_rule_fmls;
@@ -475,6 +483,17 @@ namespace datalog {
 
         void transform_rules(rule_transformer& transf);
         void transform_rules(rule_transformer::plugin* plugin);
+
+        /**
+           \brief Cache of rules simplified by the interpreted tail simplifier.
+           It is keyed on the rules present when the last query started, so
+           it is retained across queries and bounded by the number of rules.
+           A null result marks a rule that was found to be redundant.
+         */
+        bool find_simplified_rule(rule* r, rule*& result);
+        void insert_simplified_rule(rule* r, rule* result);
+        unsigned get_num_simplified_rules() const { return m_simplified_rules.size(); }
+        unsigned get_simplified_rules_hits() const { return m_simplified_rules_hits; }
         void replace_rules(rule_set const& rs);
         void record_transformed_rules();
 
@@ -613,6 +632,8 @@ namespace datalog {
 
         void flush_add_rules();
 
+        void sync_simplified_rules();
+
         void ensure_engine();
 
         // auxiliary functions for SMT2 pretty-printer.
@@ -1154,18 +1154,23 @@ namespace datalog {
         lbool check() {
             setup();
             unsigned max_depth = b.m_ctx.get_params().bmc_linear_unrolling_depth();
-            for (unsigned i = 0; i < max_depth; ++i) {
-                IF_VERBOSE(1, verbose_stream() << "level: " << i << "\n";);
-                b.checkpoint();
-                compile(i);
-                lbool res = check(i);
+            unsigned window = std::max(1u, b.m_ctx.get_params().bmc_linear_unrolling_window());
+            for (unsigned i = 0; i < max_depth; ) {
+                unsigned j = i;
+                for (; j < max_depth && j - i < window; ++j) {
+                    IF_VERBOSE(1, verbose_stream() << "level: " << j << "\n";);
+                    b.checkpoint();
+                    compile(j);
+                }
+                lbool res = check(i, j);
                 if (res == l_undef) {
                     return res;
                 }
                 if (res == l_true) {
-                    get_model(i);
+                    get_model(get_sat_level(i, j));
                     return res;
                 }
+                i = j;
             }
             return l_undef;
         }
@@ -1289,10 +1294,45 @@ namespace datalog {
         }
 
 
-        lbool check(unsigned level) {
-            expr_ref level_query = mk_level_predicate(b.m_query_pred, level);
-            expr* q = level_query.get();
-            return b.m_solver->check_sat(1, &q);
+        /**
+           \brief check whether the query is reachable at some level in [lo, hi).
+           Windows wider than one level are guarded by a fresh assumption literal
+           so that the same solver (and its learned clauses) is reused for 
+           subsequent windows.
+        */
+        lbool check(unsigned lo, unsigned hi) {
+            SASSERT(lo < hi);
+            if (hi == lo + 1) {
+                expr_ref level_query = mk_level_predicate(b.m_query_pred, lo);
+                expr* q = level_query.get();
+                return b.m_solver->check_sat(1, &q);
+            }
+            expr_ref_vector queries(m);
+            for (unsigned i = lo; i < hi; ++i) {
+                queries.push_back(mk_level_predicate(b.m_query_pred, i));
+            }
+            expr_ref guard(m.mk_fresh_const("window", m.mk_bool_sort()), m), tmp(m);
+            bool_rewriter(m).mk_or(queries.size(), queries.c_ptr(), tmp);
+            tmp = m.mk_implies(guard, tmp);
+            b.assert_expr(tmp);
+            expr* g = guard.get();
+            return b.m_solver->check_sat(1, &g);
+        }
+
+        unsigned get_sat_level(unsigned lo, unsigned hi) {
+            if (hi == lo + 1) {
+                return lo;
+            }
+            model_ref md;
+            b.m_solver->get_model(md);
+            for (unsigned i = lo; i < hi; ++i) {
+                expr_ref level_query = mk_level_predicate(b.m_query_pred, i);
+                if (md->is_true(level_query)) {
+                    return i;
+                }
+            }
+            UNREACHABLE();
+            return lo;
         }
 
         expr_ref mk_level_predicate(func_decl* p, unsigned level) {
@@ -583,12 +583,14 @@ namespace datalog {
             return m_rs_aux_copy.get_predicate_strat(pred);
         }
 
-        cost estimate_size(app * t) const {
-            func_decl * pred = t->get_decl();
-            unsigned n = pred->get_arity();
+        /**
+           \brief retrieve the number of rows of the relation for pred, 
+           if it has already been computed.
+        */
+        bool get_relation_size(func_decl * pred, cost & rel_size) const {
             rel_context_base* rel = m_context.get_rel_context();
             if (!rel) {
-                return cost(1);
+                return false;
             }
             relation_manager& rm = rel->get_rmanager();
             if ( (m_context.saturation_was_run() && rm.try_get_relation(pred))
@@ -596,15 +598,41 @@ namespace datalog {
                 SASSERT(rm.try_get_relation(pred)); //if it is saturated, it should exist
                 unsigned rel_size_int = rel->get_relation(pred).get_size_estimate_rows();
                 if (rel_size_int != 0) {
-                    cost rel_size = static_cast<cost>(rel_size_int);
-                    cost curr_size = rel_size;
-                    for (unsigned i = 0; i < n; i++) {
-                        if (!is_var(t->get_arg(i))) {
-                            curr_size /= get_domain_size(pred, i);
-                        }
+                    rel_size = static_cast<cost>(rel_size_int);
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        /**
+           \brief estimate the number of distinct values in a column:
+           it is bounded by both the domain size and the number of rows.
+        */
+        cost get_column_size(func_decl * pred, unsigned arg_index) const {
+            cost dom_size = get_domain_size(pred, arg_index);
+            cost rel_size;
+            if (get_relation_size(pred, rel_size) && rel_size < dom_size) {
+                return rel_size;
+            }
+            return dom_size;
+        }
+
+        cost estimate_size(app * t) const {
+            func_decl * pred = t->get_decl();
+            unsigned n = pred->get_arity();
+            if (!m_context.get_rel_context()) {
+                return cost(1);
+            }
+            cost rel_size;
+            if (get_relation_size(pred, rel_size)) {
+                cost curr_size = rel_size;
+                for (unsigned i = 0; i < n; i++) {
+                    if (!is_var(t->get_arg(i))) {
+                        curr_size /= get_column_size(pred, i);
                     }
-                    return curr_size;
                 }
+                return curr_size;
             }
             cost res = 1;
             for (unsigned i = 0; i < n; i++) {
@@ -628,7 +656,8 @@ namespace datalog {
                 vi.get(i, arg_index1, arg_index2);
                 SASSERT(is_var(t1->get_arg(arg_index1)));
                 if (non_local_vars.contains(to_var(t1->get_arg(arg_index1))->get_idx())) {
-                    inters_size *= get_domain_size(t1_pred, arg_index1);
+                    inters_size *= std::max(get_column_size(t1_pred, arg_index1), 
+                                            get_column_size(t2_pred, arg_index2));
                 }
                 //joined arguments must have the same domain
                 SASSERT(get_domain_size(t1_pred, arg_index1)==get_domain_size(t2_pred, arg_index2));
@@ -637,13 +666,13 @@ namespace datalog {
             for (unsigned i = 0; i < t1->get_num_args(); ++i) {
                 if (is_var(t1->get_arg(i)) && 
                     !non_local_vars.contains(to_var(t1->get_arg(i))->get_idx())) {
-                    inters_size *= get_domain_size(t1_pred, i);
+                    inters_size *= get_column_size(t1_pred, i);
                 }
             }
             for (unsigned i = 0; i < t2->get_num_args(); ++i) {
                 if (is_var(t2->get_arg(i)) && 
                     !non_local_vars.contains(to_var(t2->get_arg(i))->get_idx())) {
-                    inters_size *= get_domain_size(t2_pred, i);
+                    inters_size *= get_column_size(t2_pred, i);
                 }
             }
 
@@ -216,16 +216,21 @@ public:
         }
     }
     void intersect(M& m, union_bvec const& other) {
-        unsigned sz = other.size();        
-        union_bvec tmp, result;
+        // intersect pairwise into a scratch element that is only 
+        // kept when the intersection is non-empty.
+        unsigned sz = other.size(), sz2 = size();
+        union_bvec result;
+        T* r = nullptr;
         for (unsigned i = 0; i < sz; ++i) {
-            tmp.copy(m, *this);
-            tmp.intersect(m, other[i]);
-            for (unsigned j = 0; j < tmp.size(); ++j) {
-                result.push_back(tmp.m_elems[j]);
+            for (unsigned j = 0; j < sz2; ++j) {
+                if (!r) r = m.allocate();
+                if (m.intersect(*m_elems[j], other[i], *r)) {
+                    result.push_back(r);
+                    r = nullptr;
+                }
             }
-            tmp.m_elems.reset();
         }
+        if (r) m.deallocate(r);
         std::swap(*this, result);
         result.reset(m);
     }
@@ -209,8 +209,17 @@ tbv& tbv_manager::set_or(tbv& dst,  tbv const& src) const {
     return dst;
 }
 bool tbv_manager::set_and(tbv& dst,  tbv const& src) const {
-    m.set_and(dst, src); 
-    return is_well_formed(dst);
+    // conjoin and check for BIT_z in a single pass over the words.
+    unsigned nw = m.num_words();
+    if (nw == 0) return true;
+    unsigned z = 0, w;
+    for (unsigned i = 0; i + 1 < nw; ++i) {
+        w = (dst.m_data[i] &= src.m_data[i]);
+        z |= ~(w | (w >> 1));
+    }
+    w = (dst.m_data[nw-1] &= src.m_data[nw-1]);
+    z |= ~(w | (w >> 1)) & m.get_mask();
+    return (z & 0x55555555) == 0;
 }
 
 bool tbv_manager::is_well_formed(tbv const& dst) const {
@@ -231,21 +240,28 @@ bool tbv_manager::is_well_formed(tbv const& dst) const {
 
 void tbv_manager::complement(tbv const& src, ptr_vector<tbv>& result) {
     tbv* r;
-    unsigned n = num_tbits();
-    for (unsigned i = 0; i < n; ++i) {
-        switch (src.get(i)) {
-        case BIT_0:
-            r = allocate(src);
-            set(*r, i, BIT_1);
-            result.push_back(r);
-            break;
-        case BIT_1:
-            r = allocate(src);
-            set(*r, i, BIT_0);
-            result.push_back(r);
-            break;
-        default:
-            break;
+    unsigned nw = m.num_words();
+    for (unsigned i = 0; i < nw; ++i) {
+        // skip words where every tbit is BIT_x.
+        unsigned w = src.m_data[i];
+        unsigned fixed = ~(w & (w >> 1)) & 0x55555555;
+        if (i + 1 == nw) fixed &= m.get_mask();
+        for (unsigned j = 0; fixed != 0; ++j, fixed >>= 2) {
+            unsigned idx = 16*i + j;
+            switch (fixed & 0x1 ? src.get(idx) : BIT_x) {
+            case BIT_0:
+                r = allocate(src);
+                set(*r, idx, BIT_1);
+                result.push_back(r);
+                break;
+            case BIT_1:
+                r = allocate(src);
+                set(*r, idx, BIT_0);
+                result.push_back(r);
+                break;
+            default:
+                break;
+            }
         }
     }
 }
@@ -271,8 +287,16 @@ bool tbv_manager::contains(tbv const& a, unsigned_vector const& colsa,
 }
 
 bool tbv_manager::intersect(tbv const& a, tbv const& b, tbv& result) {
-    copy(result, a);
-    return set_and(result, b);
+    unsigned nw = m.num_words();
+    if (nw == 0) return true;
+    unsigned z = 0, w;
+    for (unsigned i = 0; i + 1 < nw; ++i) {
+        w = result.m_data[i] = a.m_data[i] & b.m_data[i];
+        z |= ~(w | (w >> 1));
+    }
+    w = result.m_data[nw-1] = a.m_data[nw-1] & b.m_data[nw-1];
+    z |= ~(w | (w >> 1)) & m.get_mask();
+    return (z & 0x55555555) == 0;
 }
 
 std::ostream& tbv_manager::display(std::ostream& out, tbv const& b, unsigned hi, unsigned lo) const {
@@ -493,6 +493,24 @@ namespace tb {
 
     // subsumption index structure.
     class index {
+        struct stats {
+            stats() { reset(); }
+            void reset() { memset(this, 0, sizeof(*this)); }
+            unsigned m_num_lookups;
+            unsigned m_num_variant_hits;
+            unsigned m_num_match_attempts;
+        };
+
+        // clauses are keyed by a variant-canonical form:
+        // variables are renamed in order of first occurrence in
+        // head, predicates and constraint.
+        struct variant {
+            unsigned m_hash;
+            unsigned m_offset;  // offset of canonical key in m_variant_keys
+            unsigned m_size;
+            unsigned m_seqno;
+        };
+
         ast_manager&           m;
         app_ref_vector         m_preds;
         app_ref                m_head;
@@ -509,6 +527,13 @@ namespace tb {
         bool_rewriter          m_rw;
         smt_params             m_fparams;
         smt::kernel            m_solver;
+        obj_map<func_decl, unsigned_vector> m_decl2index;
+        expr_ref_vector        m_variant_keys;
+        svector<variant>       m_variants;
+        u_map<unsigned_vector> m_hash2variants;
+        expr_ref_vector        m_key;
+        unsigned_vector        m_var_order;
+        stats                  m_stats;
 
     public:
         index(ast_manager& m):
@@ -522,13 +547,31 @@ namespace tb {
             m_subst(m),
             m_qe(m, params_ref()),
             m_rw(m),
-            m_solver(m, m_fparams) {}
+            m_solver(m, m_fparams),
+            m_variant_keys(m),
+            m_key(m) {}
 
         void insert(ref<clause>& g) {
+            func_decl* d = g->get_decl();
+            m_decl2index.insert_if_not_there2(d, unsigned_vector())->get_data().m_value.push_back(m_index.size());
             m_index.push_back(g);
+
+            variant v;
+            v.m_hash   = mk_variant_key(*g, m_key);
+            v.m_offset = m_variant_keys.size();
+            v.m_size   = m_key.size();
+            v.m_seqno  = g->get_seqno();
+            m_variant_keys.append(m_key);
+            m_hash2variants.insert_if_not_there2(v.m_hash, unsigned_vector())->get_data().m_value.push_back(m_variants.size());
+            m_variants.push_back(v);
         }
 
         bool is_subsumed(ref<tb::clause>& g, unsigned& subsumer) {
+            m_stats.m_num_lookups++;
+            if (find_variant(*g, subsumer)) {
+                m_stats.m_num_variant_hits++;
+                return true;
+            }
             setup(*g);
             m_clause = g;
             m_solver.push();
@@ -541,10 +584,99 @@ namespace tb {
 
         void reset() {
             m_index.reset();
+            m_decl2index.reset();
+            m_variant_keys.reset();
+            m_variants.reset();
+            m_hash2variants.reset();
+        }
+
+        void reset_statistics() {
+            m_stats.reset();
+        }
+
+        void collect_statistics(statistics& st) const {
+            st.update("tab.index.lookups", m_stats.m_num_lookups);
+            st.update("tab.index.variant_hits", m_stats.m_num_variant_hits);
+            st.update("tab.index.match_attempts", m_stats.m_num_match_attempts);
         }
 
     private:
 
+        // Rename variables of g by order of first occurrence and 
+        // return the hash of the resulting canonical key.
+        unsigned mk_variant_key(clause const& g, expr_ref_vector& key) {
+            ptr_vector<sort> sorts;
+            g.get_free_vars(sorts);
+            m_var_order.reset();
+            m_var_order.resize(sorts.size(), UINT_MAX);
+            unsigned num_vars = 0;
+            ptr_vector<expr> todo;
+            ast_mark visited;
+            todo.push_back(g.get_constraint());
+            for (unsigned i = g.get_num_predicates(); i-- > 0; ) {
+                todo.push_back(g.get_predicate(i));
+            }
+            todo.push_back(g.get_head());
+            while (!todo.empty()) {
+                expr* e = todo.back();
+                todo.pop_back();
+                if (visited.is_marked(e)) {
+                    continue;
+                }
+                visited.mark(e, true);
+                if (is_var(e)) {
+                    unsigned idx = to_var(e)->get_idx();
+                    if (m_var_order[idx] == UINT_MAX) {
+                        m_var_order[idx] = num_vars++;
+                    }
+                }
+                else if (is_app(e)) {
+                    app* a = to_app(e);
+                    for (unsigned i = a->get_num_args(); i-- > 0; ) {
+                        todo.push_back(a->get_arg(i));
+                    }
+                }
+            }
+            expr_ref_vector vars(m);
+            for (unsigned i = 0; i < sorts.size(); ++i) {
+                vars.push_back(m.mk_var(sorts[i] ? m_var_order[i] : i, sorts[i] ? sorts[i] : m.mk_bool_sort()));
+            }
+            var_subst vs(m, false);
+            key.reset();
+            key.push_back(vs(g.get_head(), vars.size(), vars.c_ptr()));
+            for (unsigned i = 0; i < g.get_num_predicates(); ++i) {
+                key.push_back(vs(g.get_predicate(i), vars.size(), vars.c_ptr()));
+            }
+            key.push_back(vs(g.get_constraint(), vars.size(), vars.c_ptr()));
+            unsigned h = key.size();
+            for (expr* e : key) {
+                h = combine_hash(h, e->get_id());
+            }
+            return h;
+        }
+
+        // canonical keys are hash-consed, so variants have identical keys.
+        bool find_variant(clause const& g, unsigned& subsumer) {
+            unsigned h = mk_variant_key(g, m_key);
+            auto* e = m_hash2variants.find_core(h);
+            if (!e) {
+                return false;
+            }
+            for (unsigned idx : e->get_data().m_value) {
+                variant const& v = m_variants[idx];
+                if (v.m_size != m_key.size()) {
+                    continue;
+                }
+                unsigned j = 0;
+                for (; j < v.m_size && m_variant_keys.get(v.m_offset + j) == m_key.get(j); ++j);
+                if (j == v.m_size) {
+                    subsumer = v.m_seqno;
+                    return true;
+                }
+            }
+            return false;
+        }
+
         void setup(clause const& g) {
             m_preds.reset();
             m_refs.reset();
@@ -581,7 +713,15 @@ namespace tb {
 
         // extract pre_cond => post_cond validation obligation from match.
         bool find_match(unsigned& subsumer) {
-            for (unsigned i = 0; !m.canceled() && i < m_index.size(); ++i) {
+            // only clauses with the same head predicate can match.
+            auto* e = m_decl2index.find_core(m_head->get_decl());
+            if (!e) {
+                return false;
+            }
+            unsigned_vector const& idxs = e->get_data().m_value;
+            for (unsigned j = 0; !m.canceled() && j < idxs.size(); ++j) {
+                unsigned i = idxs[j];
+                m_stats.m_num_match_attempts++;
                 if (match_rule(i)) {
                     subsumer = m_index[i]->get_seqno();
                     return true;
@@ -1384,12 +1524,14 @@ namespace datalog {
 
         void reset_statistics() {
             m_stats.reset();
+            m_index.reset_statistics();
         }
 
         void collect_statistics(statistics& st) const {
             st.update("tab.num_unfold", m_stats.m_num_unfold);
             st.update("tab.num_unfold_fail", m_stats.m_num_no_unfold);
             st.update("tab.num_subsumed", m_stats.m_num_subsumed);
+            m_index.collect_statistics(st);
         }
 
         void display_certificate(std::ostream& out) const {
@@ -586,7 +586,17 @@ namespace datalog {
         rule_set::iterator rend = orig.end();
         for (; rit!=rend; ++rit) {
             rule_ref new_rule(rm);
-            if (transform_rule(*rit, new_rule)) {
+            rule* cached = nullptr;
+            bool keep;
+            if (m_context.find_simplified_rule(*rit, cached)) {
+                new_rule = cached;
+                keep = cached != nullptr;
+            }
+            else {
+                keep = transform_rule(*rit, new_rule);
+                m_context.insert_simplified_rule(*rit, keep ? new_rule.get() : nullptr);
+            }
+            if (keep) {
                 rm.mk_rule_rewrite_proof(**rit, *new_rule.get());
                 bool is_modified = *rit != new_rule;
                 modified |= is_modified;
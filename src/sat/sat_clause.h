@@ -41,10 +41,10 @@ namespace sat {
     class clause {
         friend class clause_allocator;
         friend class tmp_clause;
+        var_approx_set     m_approx;     // 64-bit signature, first to avoid padding
         unsigned           m_id;
         unsigned           m_size;
         unsigned           m_capacity;
-        var_approx_set     m_approx;
         unsigned           m_strengthened:1;
         unsigned           m_removed:1;
         unsigned           m_learned:1;
@@ -143,6 +143,7 @@ namespace sat {
         clause_allocator();
         void          finalize();
         size_t        get_allocation_size() const { return m_allocator.get_allocation_size(); }
+        size_t        get_free_size() const { return m_allocator.get_free_size(); }
         clause *      get_clause(clause_offset cls_off) const;
         clause_offset get_offset(clause const * ptr) const;
         clause *      mk_clause(unsigned num_lits, literal const * lits, bool learned);
@@ -19,15 +19,93 @@ Author:
 Notes:
 
 --*/
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "sat_solver.h"
 #include "sat_drat.h"
 
 
 namespace sat {
+
+    /**
+       \brief double buffered proof output.
+       The solver appends to m_buffer. Full buffers are handed to a
+       background thread that writes them to the proof stream, so
+       the solver does not block on file I/O.
+    */
+    class drat::writer {
+        static const unsigned   s_buffer_size = 1 << 20;
+        std::ostream&           m_out;
+        svector<char>           m_buffer;     // filled by the solver
+        svector<char>           m_pending;    // written by the background thread
+        bool                    m_has_pending;
+        bool                    m_done;
+        std::mutex              m_mux;
+        std::condition_variable m_cond;
+        std::thread             m_thread;
+
+        void run() {
+            std::unique_lock<std::mutex> lock(m_mux);
+            while (true) {
+                m_cond.wait(lock, [this] { return m_has_pending || m_done; });
+                if (!m_has_pending) 
+                    break;
+                lock.unlock();
+                m_out.write(m_pending.c_ptr(), m_pending.size());
+                m_pending.reset();
+                lock.lock();
+                m_has_pending = false;
+                m_cond.notify_all();
+            }
+        }
+
+        void hand_off() {
+            std::unique_lock<std::mutex> lock(m_mux);
+            m_cond.wait(lock, [this] { return !m_has_pending; });
+            m_buffer.swap(m_pending);
+            m_has_pending = true;
+            m_cond.notify_all();
+        }
+
+    public:
+        writer(std::ostream& out): 
+            m_out(out), 
+            m_has_pending(false), 
+            m_done(false),
+            m_thread([this] { run(); }) {
+        }
+
+        ~writer() {
+            flush();
+            {
+                std::lock_guard<std::mutex> lock(m_mux);
+                m_done = true;
+                m_cond.notify_all();
+            }
+            m_thread.join();
+        }
+
+        void write(char const* data, unsigned len) {
+            m_buffer.append(len, data);
+            if (m_buffer.size() >= s_buffer_size) 
+                hand_off();
+        }
+
+        void flush() {
+            if (!m_buffer.empty()) 
+                hand_off();
+            std::unique_lock<std::mutex> lock(m_mux);
+            m_cond.wait(lock, [this] { return !m_has_pending; });
+            m_out.flush();
+        }
+    };
+
     drat::drat(solver& s):
         s(s),
         m_out(nullptr),
         m_bout(nullptr),
+        m_writer(nullptr),
         m_inconsistent(false),
         m_check_unsat(false),
         m_check_sat(false),
@@ -36,6 +114,7 @@ namespace sat {
         if (s.m_config.m_drat && s.m_config.m_drat_file != symbol()) {
             auto mode = s.m_config.m_drat_binary ? (std::ios_base::binary | std::ios_base::out | std::ios_base::trunc) : std::ios_base::out;
             m_out = alloc(std::ofstream, s.m_config.m_drat_file.str().c_str(), mode);
+            m_writer = alloc(writer, *m_out);
             if (s.m_config.m_drat_binary) {
                 std::swap(m_out, m_bout);
             }
@@ -43,6 +122,7 @@ namespace sat {
     }
 
     drat::~drat() {
+        dealloc(m_writer);
         if (m_out) m_out->flush();
         if (m_bout) m_bout->flush();
         dealloc(m_out);
@@ -56,6 +136,16 @@ namespace sat {
         m_proof.reset();
         m_out = nullptr;
         m_bout = nullptr;
+        m_writer = nullptr;
+    }
+
+    void drat::write(char const* buffer, unsigned len) {
+        if (m_writer) {
+            m_writer->write(buffer, len);
+        }
+        else {
+            (m_out ? m_out : m_bout)->write(buffer, len);
+        }
     }
 
     void drat::updt_config() {
@@ -105,13 +195,13 @@ namespace sat {
 	    len += static_cast<unsigned>(lastd - d);            
 	    buffer[len++] = ' ';
 	    if (len + 50 > sizeof(buffer)) {
-	        m_out->write(buffer, len);
+	        write(buffer, len);
 	        len = 0;
             }
         }        
 	buffer[len++] = '0';
 	buffer[len++] = '\n';
-	m_out->write(buffer, len);               
+	write(buffer, len);
     }
 
     void drat::bdump(unsigned n, literal const* c, status st) {
@@ -136,14 +226,14 @@ namespace sat {
                 if (v) ch |= 128;
                 buffer[len++] = ch;
                 if (len == sizeof(buffer)) {
-                    m_bout->write(buffer, len);
+                    write(buffer, len);
                     len = 0;
                 }
             }
             while (v);
         }
         buffer[len++] = 0;
-        m_bout->write(buffer, len);
+        write(buffer, len);
     }
 
     bool drat::is_cleaned(clause& c) const {
@@ -648,7 +738,7 @@ namespace sat {
     }
 
     void drat::add() {
-        if (m_out) (*m_out) << "0\n";
+        if (m_out) dump(0, nullptr, status::learned);
         if (m_bout) bdump(0, nullptr, status::learned);
         if (m_check_unsat) {
             SASSERT(m_inconsistent);
@@ -42,12 +42,14 @@ namespace sat {
             watched_clause(clause* c, literal l1, literal l2):
                 m_clause(c), m_l1(l1), m_l2(l2) {}
         };
+        class writer;
         svector<watched_clause>   m_watched_clauses;
         typedef svector<unsigned> watch;
         solver& s;
         clause_allocator        m_alloc;
         std::ostream*           m_out;
         std::ostream*           m_bout;
+        writer*                 m_writer;     // buffers proof output and writes it from a background thread
         ptr_vector<clause>      m_proof;
         svector<status>         m_status;
         literal_vector          m_units;
@@ -56,6 +58,7 @@ namespace sat {
         bool                    m_inconsistent;
         bool                    m_check_unsat, m_check_sat, m_check;
 
+        void write(char const* buffer, unsigned len);
         void dump(unsigned n, literal const* c, status st);
         void bdump(unsigned n, literal const* c, status st);
         void append(literal l, status st);
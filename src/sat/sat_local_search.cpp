@@ -525,6 +525,7 @@ namespace sat {
                     set_best_unsat();
                     m_last_best_unsat_rate = m_best_unsat_rate;
                     m_best_unsat_rate = (double)m_unsat_stack.size() / num_constraints();                                        
+                    if (m_par) m_par->set_best(*this);
                 }
                 if (m_is_unsat) return;                    
             }
@@ -534,6 +535,9 @@ namespace sat {
                 reinit();
             }
             if (tries % 10 == 0 && !m_unsat_stack.empty()) {
+                if (m_par && m_par->get_best(*this)) {
+                    ++m_stats.m_num_warm_starts;
+                }
                 reinit();
             }            
         }
@@ -831,6 +835,7 @@ namespace sat {
         }
         st.update("local-search-flips", m_stats.m_num_flips);
         st.update("local-search-restarts", m_stats.m_num_restarts);
+        st.update("local-search-warm-starts", m_stats.m_num_warm_starts);
     }
 
 
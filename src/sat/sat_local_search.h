@@ -82,6 +82,7 @@ namespace sat {
         struct stats {
             unsigned m_num_flips;
             unsigned m_num_restarts;
+            unsigned m_num_warm_starts;
             void reset() { memset(this, 0, sizeof(*this)); }
             stats() { reset(); }
         };
@@ -249,6 +250,8 @@ namespace sat {
 
         unsigned num_non_binary_clauses() const { return m_num_non_binary_clauses; }
 
+        unsigned num_unsat() const { return m_unsat_stack.size(); }
+
         void import(solver& s, bool init);        
 
         void set_phase(bool_var v, lbool f);
@@ -91,7 +91,13 @@ namespace sat {
         return false;
     }
 
-    parallel::parallel(solver& s): m_num_clauses(0), m_consumer_ready(false), m_scoped_rlimit(s.rlimit()) {}
+    parallel::parallel(solver& s): m_num_clauses(0), m_consumer_ready(false), m_best_unsat(UINT_MAX), m_scoped_rlimit(s.rlimit()) {}
+
+    void parallel::reserve(unsigned num_owners, unsigned sz) { 
+        m_pool.reserve(num_owners, sz); 
+        m_shared_hashes.reset();
+        m_shared_hashes.resize(sz / 4, 0);
+    }
 
     parallel::~parallel() {
         for (unsigned i = 0; i < m_solvers.size(); ++i) {            
@@ -103,15 +109,34 @@ namespace sat {
         unsigned num_threads = num_extra_solvers + 1;
         m_solvers.resize(num_extra_solvers);
         symbol saved_phase = s.m_params.get_sym("phase", symbol("caching"));
+        symbol saved_restart = s.m_params.get_sym("restart", symbol("ema"));
+        symbol saved_branching = s.m_params.get_sym("branching.heuristic", symbol("vsids"));
+        unsigned saved_delay = s.m_params.get_uint("simplify.delay", 0);
+        bool diversify = s.m_params.get_bool("threads.diversify", true);
         for (unsigned i = 0; i < num_extra_solvers; ++i) {        
             m_limits.push_back(reslimit());
         }
         
+        symbol phase = saved_phase;
         for (unsigned i = 0; i < num_extra_solvers; ++i) {
             s.m_params.set_uint("random_seed", s.m_rand());
             if (i == 1 + num_threads/2) {
-                s.m_params.set_sym("phase", symbol("random"));
+                phase = symbol("random");
             }                        
+            s.m_params.set_sym("phase", phase);
+            if (diversify) {
+                // give each worker a different combination of restart policy,
+                // branching heuristic and simplification schedule.
+                // Odd workers use chb, so it is used as soon as there are two
+                // auxiliary workers. Workers with a random phase keep it.
+                static char const* restarts[3] = { "luby", "geometric", "ema" };
+                s.m_params.set_sym("restart", symbol(restarts[i % 3]));
+                s.m_params.set_sym("branching.heuristic", symbol(i % 2 == 0 ? "vsids" : "chb"));
+                s.m_params.set_uint("simplify.delay", ((i / 2) % 2) * 10000);
+                if (i % 4 == 3 && phase != symbol("random")) {
+                    s.m_params.set_sym("phase", symbol("always_false"));
+                }
+            }
             m_solvers[i] = alloc(sat::solver, s.m_params, m_limits[i]);
             m_solvers[i]->copy(s, true);
             m_solvers[i]->set_par(this, i);
@@ -119,6 +144,9 @@ namespace sat {
         }
         s.set_par(this, num_extra_solvers);
         s.m_params.set_sym("phase", saved_phase);        
+        s.m_params.set_sym("restart", saved_restart);
+        s.m_params.set_sym("branching.heuristic", saved_branching);
+        s.m_params.set_uint("simplify.delay", saved_delay);
     }
 
     void parallel::push_child(reslimit& rl) {
@@ -129,8 +157,8 @@ namespace sat {
     void parallel::exchange(solver& s, literal_vector const& in, unsigned& limit, literal_vector& out) {
         if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
-        #pragma omp critical (par_solver)
         {
+            std::lock_guard<std::mutex> lock(m_mux);
             if (limit < m_units.size()) {
                 // this might repeat some literals.
                 out.append(m_units.size() - limit, m_units.c_ptr() + limit);
@@ -146,61 +174,111 @@ namespace sat {
         }
     }
 
+    /**
+       \brief check whether a clause with the same literals was shared recently.
+       The table is direct mapped, so older entries are overwritten and 
+       duplicates are only detected approximately. Must be called within 
+       holding m_mux.
+     */
+    bool parallel::is_duplicate(unsigned n, literal const* lits) {
+        if (m_shared_hashes.empty()) {
+            return false;
+        }
+        // order independent hash of the literals.
+        unsigned h = n;
+        for (unsigned i = 0; i < n; ++i) {
+            h += hash_u(lits[i].index());
+        }
+        if (h == 0) h = 1;
+        unsigned& slot = m_shared_hashes[h % m_shared_hashes.size()];
+        if (slot == h) {
+            return true;
+        }
+        slot = h;
+        return false;
+    }
+
     void parallel::share_clause(solver& s, literal l1, literal l2) {        
         if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": share " <<  l1 << " " << l2 << "\n";);
-        #pragma omp critical (par_solver)
+        literal lits[2] = { l1, l2 };
+        bool shared = false;
         {
-            m_pool.begin_add_vector(s.m_par_id, 2);
-            m_pool.add_vector_elem(l1.index());
-            m_pool.add_vector_elem(l2.index());            
-            m_pool.end_add_vector();
+            std::lock_guard<std::mutex> lock(m_mux);
+            if (!is_duplicate(2, lits)) {
+                m_pool.begin_add_vector(s.m_par_id, 2);
+                m_pool.add_vector_elem(l1.index());
+                m_pool.add_vector_elem(l2.index());            
+                m_pool.end_add_vector();
+                shared = true;
+            }
         }        
+        if (shared) s.m_stats.m_par_exported++; else s.m_stats.m_par_dropped++;
     }
 
     void parallel::share_clause(solver& s, clause const& c) {        
-        if (s.get_config().m_num_threads == 1 || !enable_add(c) || s.m_par_syncing_clauses) return;
+        if (s.get_config().m_num_threads == 1 || s.m_par_syncing_clauses) return;
+        if (!enable_add(c)) {
+            s.m_stats.m_par_dropped++;
+            return;
+        }
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
         unsigned n = c.size();
         unsigned owner = s.m_par_id;
         IF_VERBOSE(3, verbose_stream() << owner << ": share " <<  c << "\n";);
-        #pragma omp critical (par_solver)
+        bool shared = false;
         {
-            m_pool.begin_add_vector(owner, n);                
-            for (unsigned i = 0; i < n; ++i) {
-                m_pool.add_vector_elem(c[i].index());
+            std::lock_guard<std::mutex> lock(m_mux);
+            if (!is_duplicate(n, c.begin())) {
+                m_pool.begin_add_vector(owner, n);                
+                for (unsigned i = 0; i < n; ++i) {
+                    m_pool.add_vector_elem(c[i].index());
+                }
+                m_pool.end_add_vector();
+                shared = true;
             }
-            m_pool.end_add_vector();
         }
+        if (shared) s.m_stats.m_par_exported++; else s.m_stats.m_par_dropped++;
     }
 
     void parallel::get_clauses(solver& s) {
         if (s.m_par_syncing_clauses) return;
         flet<bool> _disable_sync_clause(s.m_par_syncing_clauses, true);
-        #pragma omp critical (par_solver)
+        // copy clauses out of the pool while holding the lock,
+        // but add them to the solver after releasing it.
+        unsigned_vector clauses;
         {
-            _get_clauses(s);
+            std::lock_guard<std::mutex> lock(m_mux);
+            _get_clauses(s, clauses);
+        }
+        literal_vector lits;
+        for (unsigned i = 0; i < clauses.size(); ) {
+            unsigned n = clauses[i++];
+            SASSERT(n >= 2);
+            lits.reset();
+            bool usable_clause = true;
+            for (unsigned j = 0; j < n; ++j) {
+                literal lit(to_literal(clauses[i + j]));
+                lits.push_back(lit);
+                usable_clause &= lit.var() <= s.m_par_num_vars && !s.was_eliminated(lit.var());
+            }
+            i += n;
+            IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << lits << "\n";);
+            if (usable_clause) {
+                s.m_stats.m_par_imported++;
+                s.mk_clause_core(lits.size(), lits.c_ptr(), true);
+            }
         }
     }
 
-    void parallel::_get_clauses(solver& s) {
+    void parallel::_get_clauses(solver& s, unsigned_vector& clauses) {
         unsigned n;
         unsigned const* ptr;
         unsigned owner = s.m_par_id;
         while (m_pool.get_vector(owner, n, ptr)) {
-            m_lits.reset();
-            bool usable_clause = true;
-            for (unsigned i = 0; usable_clause && i < n; ++i) {
-                literal lit(to_literal(ptr[i]));                
-                m_lits.push_back(lit);
-                usable_clause = lit.var() <= s.m_par_num_vars && !s.was_eliminated(lit.var());
-            }
-            IF_VERBOSE(3, verbose_stream() << s.m_par_id << ": retrieve " << m_lits << "\n";);
-            SASSERT(n >= 2);
-            if (usable_clause) {
-                s.mk_clause_core(m_lits.size(), m_lits.c_ptr(), true);
-            }
+            clauses.push_back(n);
+            clauses.append(n, ptr);
         }        
     }
 
@@ -241,15 +319,15 @@ namespace sat {
     }
 
     void parallel::set_phase(solver& s) {
-        #pragma omp critical (par_solver)
         {
+            std::lock_guard<std::mutex> lock(m_mux);
             _set_phase(s);
         }
     }
 
     void parallel::get_phase(solver& s) {
-        #pragma omp critical (par_solver)
         {
+            std::lock_guard<std::mutex> lock(m_mux);
             _get_phase(s);
         }
     }
@@ -269,8 +347,8 @@ namespace sat {
 
     bool parallel::get_phase(local_search& s) {
         bool copied = false;
-        #pragma omp critical (par_solver)
         {
+            std::lock_guard<std::mutex> lock(m_mux);
             m_consumer_ready = true;
             if (m_solver_copy && s.num_non_binary_clauses() > m_solver_copy->m_clauses.size()) {
                 copied = true;
@@ -286,10 +364,37 @@ namespace sat {
     }
 
 
+    void parallel::set_best(local_search& s) {
+        if (s.num_unsat() >= m_best_unsat) {
+            return;
+        }
+        std::lock_guard<std::mutex> lock(m_mux);
+        if (s.num_unsat() >= m_best_unsat) {
+            return;
+        }
+        m_best_unsat = s.num_unsat();
+        m_best_phase.reserve(s.num_vars(), l_undef);
+        for (unsigned i = 0; i < s.num_vars(); ++i) {
+            m_best_phase[i] = s.cur_solution(i) ? l_true : l_false;
+        }
+    }
+
+    bool parallel::get_best(local_search& s) {
+        if (m_best_unsat == UINT_MAX) {
+            return false;
+        }
+        std::lock_guard<std::mutex> lock(m_mux);
+        unsigned sz = std::min(s.num_vars(), m_best_phase.size());
+        for (unsigned i = 0; i < sz; ++i) {
+            s.set_bias(i, m_best_phase[i]);
+        }
+        return true;
+    }
+
     bool parallel::copy_solver(solver& s) {
         bool copied = false;
-        #pragma omp critical (par_solver)
         {
+            std::lock_guard<std::mutex> lock(m_mux);
             m_consumer_ready = true;
             if (m_solver_copy && s.m_clauses.size() > m_solver_copy->m_clauses.size()) {
                 s.copy(*m_solver_copy, true);
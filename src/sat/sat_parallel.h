@@ -19,6 +19,8 @@ Revision History:
 #ifndef SAT_PARALLEL_H_
 #define SAT_PARALLEL_H_
 
+#include <mutex>
+#include <atomic>
 #include "sat/sat_types.h"
 #include "util/hashtable.h"
 #include "util/map.h"
@@ -51,15 +53,17 @@ namespace sat {
         };
 
         bool enable_add(clause const& c) const;
-        void _get_clauses(solver& s);
+        bool is_duplicate(unsigned n, literal const* lits);
+        void _get_clauses(solver& s, unsigned_vector& clauses);
         void _get_phase(solver& s);
         void _set_phase(solver& s);
 
         typedef hashtable<unsigned, u_hash, u_eq> index_set;
         literal_vector m_units;
         index_set      m_unit_set;
-        literal_vector m_lits;
         vector_pool    m_pool;
+        // direct mapped table of hashes of recently shared clauses.
+        unsigned_vector m_shared_hashes;
 
         // for exchange with local search:
         svector<lbool>     m_phase;
@@ -67,6 +71,12 @@ namespace sat {
         scoped_ptr<solver> m_solver_copy;
         bool               m_consumer_ready;
 
+        // best assignment found so far by local search workers.
+        // m_best_unsat is read without taking the lock.
+        std::atomic<unsigned> m_best_unsat;
+        svector<lbool>     m_best_phase;
+
+        std::mutex         m_mux;
         scoped_limits      m_scoped_rlimit;
         vector<reslimit>   m_limits;
         ptr_vector<solver> m_solvers;
@@ -82,7 +92,7 @@ namespace sat {
         void push_child(reslimit& rl);
 
         // reserve space
-        void reserve(unsigned num_owners, unsigned sz) { m_pool.reserve(num_owners, sz); }
+        void reserve(unsigned num_owners, unsigned sz);
 
         solver& get_solver(unsigned i) { return *m_solvers[i]; }
 
@@ -106,6 +116,12 @@ namespace sat {
         
         bool get_phase(local_search& s);
 
+        // publish the current assignment of s if it improves on the best assignment.
+        void set_best(local_search& s);
+
+        // bias s towards the best assignment. Return false if there is none.
+        bool get_best(local_search& s);
+
         bool copy_solver(solver& s);
     };
 
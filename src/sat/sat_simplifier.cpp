@@ -432,13 +432,15 @@ namespace sat {
     void simplifier::collect_subsumed1_core(clause const & c1, clause_vector & out, literal_vector & out_lits,
                                             literal target) {
         clause_use_list const & cs = m_use_list.get(target);
+        var_approx_set approx1 = c1.approx();
+        unsigned sz1 = c1.size();
         for (auto it = cs.mk_iterator(); !it.at_end(); it.next()) {
             clause & c2 = it.curr();
             CTRACE("resolution_bug", c2.was_removed(), tout << "clause has been removed:\n" << c2 << "\n";);
             SASSERT(!c2.was_removed());
-            if (&c2 != &c1 &&
-                c1.size() <= c2.size() &&
-                approx_subset(c1.approx(), c2.approx())) {
+            if (sz1 <= c2.size() &&
+                approx_subset(approx1, c2.approx()) &&
+                &c2 != &c1) {
                 m_sub_counter -= c1.size() + c2.size();
                 literal l;
                 if (subsumes1(c1, c2, l)) {
@@ -541,13 +543,15 @@ namespace sat {
     */
     void simplifier::collect_subsumed0_core(clause const & c1, clause_vector & out, literal target) {
         clause_use_list const & cs = m_use_list.get(target);
+        var_approx_set approx1 = c1.approx();
+        unsigned sz1 = c1.size();
         clause_use_list::iterator it = cs.mk_iterator();
         for (; !it.at_end(); it.next()) {
             clause & c2 = it.curr();
             SASSERT(!c2.was_removed());
-            if (&c2 != &c1 &&
-                c1.size() <= c2.size() &&
-                approx_subset(c1.approx(), c2.approx())) {
+            if (sz1 <= c2.size() &&
+                approx_subset(approx1, c2.approx()) &&
+                &c2 != &c1) {
                 m_sub_counter -= c1.size() + c2.size();
                 if (subsumes0(c1, c2)) {
                     out.push_back(&c2);
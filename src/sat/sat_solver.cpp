@@ -19,6 +19,8 @@ Revision History:
 
 
 #include <cmath>
+#include <thread>
+#include <mutex>
 #include "sat/sat_solver.h"
 #include "sat/sat_integrity_checker.h"
 #include "sat/sat_lookahead.h"
@@ -49,6 +51,7 @@ namespace sat {
         m_scc(*this, p),
         m_asymm_branch(*this, p),
         m_probing(*this, p),
+        m_vivify(*this, p),
         m_mus(*this),
         m_inconsistent(false),
         m_searching(false),
@@ -544,7 +547,13 @@ namespace sat {
 
     bool solver::should_defrag() {
         if (m_defrag_threshold > 0) --m_defrag_threshold;
-        return m_defrag_threshold == 0 && m_config.m_gc_defrag;
+        if (m_defrag_threshold > 0 || !m_config.m_gc_defrag) {
+            return false;
+        }
+        // only compact when a noticeable part of the clause arena 
+        // is held in free lists of deleted clauses.
+        clause_allocator const& a = cls_allocator();
+        return 8 * a.get_free_size() >= a.get_allocation_size();
     }
 
     void solver::defrag_clauses() {
@@ -958,7 +967,16 @@ namespace sat {
                     literal * l_it  = c.begin() + 2;
                     literal * l_end = c.end();
                     for (; l_it != l_end; ++l_it) {
-                        if (value(*l_it) != l_false) {
+                        val1 = value(*l_it);
+                        if (val1 == l_true) {
+                            // the clause is satisfied: keep watching not_l and
+                            // use *l_it as the new blocker instead of moving the watch.
+                            // Sound because *l_it is assigned at a level no higher than not_l.
+                            it2->set_clause(*l_it, cls_off);
+                            it2++;
+                            goto end_clause_case;
+                        }
+                        if (val1 != l_false) {
                             c[1]  = *l_it;
                             *l_it = not_l;
                             DEBUG_CODE(for (auto const& w : m_watches[(~c[1]).index()]) VERIFY(!w.is_clause() || w.get_clause_offset() != cls_off););
@@ -1243,8 +1261,8 @@ namespace sat {
         unsigned error_code = 0;
         lbool result = l_undef;
         bool canceled = false;
-        #pragma omp parallel for
-        for (int i = 0; i < num_threads; ++i) {
+        std::mutex mux;
+        auto worker_thread = [&](int i) {
             try {
                 lbool r = l_undef;
                 if (IS_AUX_SOLVER(i)) {
@@ -1260,8 +1278,8 @@ namespace sat {
                     r = check(num_lits, lits);
                 }
                 bool first = false;
-                #pragma omp critical (par_solver)
                 {
+                    std::lock_guard<std::mutex> lock(mux);
                     if (finished_id == -1) {
                         finished_id = i;
                         first = true;
@@ -1289,15 +1307,36 @@ namespace sat {
                 }
             }
             catch (z3_error & err) {
+                std::lock_guard<std::mutex> lock(mux);
                 error_code = err.error_code();
                 ex_kind = ERROR_EX;                
             }
             catch (z3_exception & ex) {
+                std::lock_guard<std::mutex> lock(mux);
                 ex_msg = ex.msg();
                 ex_kind = DEFAULT_EX;    
             }
-        }
-        
+        };
+
+        // the main solver runs on the calling thread.
+        vector<std::thread> threads;
+        for (int i = 0; i < num_threads; ++i) {
+            if (!IS_MAIN_SOLVER(i)) {
+                threads.push_back(std::thread([&, i]() { worker_thread(i); }));
+            }
+        }
+        worker_thread(main_solver_offset);
+        for (std::thread& t : threads) {
+            t.join();
+        }
+        IF_VERBOSE(1, 
+                   for (int i = 0; i <= num_extra_solvers; ++i) {
+                       stats const& st = i < num_extra_solvers ? par.get_solver(i).m_stats : m_stats;
+                       verbose_stream() << "(sat-parallel :thread " << i 
+                                        << " :exported " << st.m_par_exported 
+                                        << " :imported " << st.m_par_imported 
+                                        << " :dropped " << st.m_par_dropped << ")\n";
+                   });
         if (IS_AUX_SOLVER(finished_id)) {
             m_stats = par.get_solver(finished_id).m_stats;
         }
@@ -1656,6 +1695,7 @@ namespace sat {
         m_conflicts_since_gc      = 0;
         m_restart_next_out        = 0;
         m_asymm_branch.init_search();
+        m_vivify.init_search();
         m_stopwatch.reset();
         m_stopwatch.start();
         m_core.reset();
@@ -1705,6 +1745,10 @@ namespace sat {
         CASSERT("sat_missed_prop", check_missed_propagation());
         CASSERT("sat_simplify_bug", check_invariant());
         m_asymm_branch(false);
+        CASSERT("sat_missed_prop", check_missed_propagation());
+        CASSERT("sat_simplify_bug", check_invariant());
+
+        m_vivify();
 
         CASSERT("sat_missed_prop", check_missed_propagation());
         CASSERT("sat_simplify_bug", check_invariant());
@@ -3472,6 +3516,7 @@ namespace sat {
         m_simplifier.updt_params(p);
         m_asymm_branch.updt_params(p);
         m_probing.updt_params(p);
+        m_vivify.updt_params(p);
         m_scc.updt_params(p);
         m_rand.set_seed(m_config.m_random_seed);
         m_step_size = m_config.m_step_size_init;
@@ -3495,6 +3540,7 @@ namespace sat {
         m_scc.collect_statistics(st);
         m_asymm_branch.collect_statistics(st);
         m_probing.collect_statistics(st);
+        m_vivify.collect_statistics(st);
         if (m_ext) m_ext->collect_statistics(st);
         if (m_local_search) m_local_search->collect_statistics(st);
         st.copy(m_aux_stats);
@@ -3506,6 +3552,7 @@ namespace sat {
         m_simplifier.reset_statistics();
         m_asymm_branch.reset_statistics();
         m_probing.reset_statistics();
+        m_vivify.reset_statistics();
         m_aux_stats.reset();
     }
 
@@ -4475,6 +4522,9 @@ namespace sat {
         st.update("sat units", m_units);
         st.update("sat elim bool vars res", m_elim_var_res);
         st.update("sat elim bool vars bdd", m_elim_var_bdd);
+        st.update("sat par exported", m_par_exported);
+        st.update("sat par imported", m_par_imported);
+        st.update("sat par dropped", m_par_dropped);
     }
 
     void stats::reset() {
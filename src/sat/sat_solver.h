@@ -33,6 +33,7 @@ Revision History:
 #include "sat/sat_asymm_branch.h"
 #include "sat/sat_iff3_finder.h"
 #include "sat/sat_probing.h"
+#include "sat/sat_vivify.h"
 #include "sat/sat_mus.h"
 #include "sat/sat_drat.h"
 #include "sat/sat_parallel.h"
@@ -71,6 +72,9 @@ namespace sat {
         unsigned m_elim_var_res;
         unsigned m_elim_var_bdd;
         unsigned m_units;
+        unsigned m_par_exported;
+        unsigned m_par_imported;
+        unsigned m_par_dropped;
         stats() { reset(); }
         void reset();
         void collect_statistics(statistics & st) const;
@@ -97,6 +101,7 @@ namespace sat {
         scc                     m_scc;
         asymm_branch            m_asymm_branch;
         probing                 m_probing;
+        vivify                  m_vivify;
         mus                     m_mus;           // MUS for minimal core extraction
         bool                    m_inconsistent;
         bool                    m_searching;
@@ -177,6 +182,7 @@ namespace sat {
         friend class elim_eqs;
         friend class asymm_branch;
         friend class probing;
+        friend class vivify;
         friend class iff3_finder;
         friend class mus;
         friend class drat;
@@ -19,6 +19,7 @@ Notes:
 
 
 #include "util/gparams.h"
+#include "util/stopwatch.h"
 #include "ast/ast_pp.h"
 #include "ast/ast_translation.h"
 #include "ast/ast_util.h"
@@ -77,6 +78,12 @@ class inc_sat_solver : public solver {
     bool                m_internalized_converted; // have internalized formulas been converted back
     expr_ref_vector     m_internalized_fmls;      // formulas in internalized format
 
+    // per call statistics
+    unsigned            m_num_checks;
+    unsigned            m_num_direct_asms;        // calls whose assumptions bypassed goal2sat
+    double              m_check_time;
+    double              m_max_check_time;
+
     typedef obj_map<expr, sat::literal> dep2asm_t;
 
     bool is_internalized() const { return m_fmls_head == m_fmls.size(); }
@@ -93,7 +100,11 @@ public:
         m_num_scopes(0),
         m_unknown("no reason given"),
         m_internalized_converted(false), 
-        m_internalized_fmls(m) {
+        m_internalized_fmls(m),
+        m_num_checks(0),
+        m_num_direct_asms(0),
+        m_check_time(0),
+        m_max_check_time(0) {
         updt_params(p);
         m_mcs.push_back(nullptr);
         init_preprocess();
@@ -195,6 +206,8 @@ public:
 
         init_reason_unknown();
         m_internalized_converted = false;
+        stopwatch sw;
+        sw.start();
         try {
             // IF_VERBOSE(0, m_solver.display(verbose_stream()));
             r = m_solver.check(m_asms.size(), m_asms.c_ptr());
@@ -203,6 +216,10 @@ public:
             IF_VERBOSE(10, verbose_stream() << "exception: " << ex.msg() << "\n";);
             r = l_undef;            
         }
+        sw.stop();
+        ++m_num_checks;
+        m_check_time += sw.get_seconds();
+        m_max_check_time = std::max(m_max_check_time, sw.get_seconds());
         switch (r) {
         case l_true:
             if (sz > 0) {
@@ -308,6 +325,10 @@ public:
     void collect_statistics(statistics & st) const override {
         if (m_preprocess) m_preprocess->collect_statistics(st);
         m_solver.collect_statistics(st);
+        st.update("sat checks", m_num_checks);
+        st.update("sat checks direct assumptions", m_num_direct_asms);
+        st.update("sat check time", m_check_time);
+        st.update("sat check max time", m_max_check_time);
     }
     void get_unsat_core(expr_ref_vector & r) override {
         r.reset();
@@ -634,6 +655,10 @@ private:
             m_asms.shrink(0);
             return l_true;
         }
+        if (internalize_known_assumptions(sz, asms, dep2asm)) {
+            ++m_num_direct_asms;
+            return l_true;
+        }
         goal_ref g = alloc(goal, m, true, true); // models and cores are enabled.
         for (unsigned i = 0; i < sz; ++i) {
             g->assert_expr(asms[i], m.mk_leaf(asms[i]));
@@ -648,6 +673,33 @@ private:
         return res;
     }
 
+    /**
+       \brief map assumptions directly to SAT literals when they are all literals 
+       over atoms that are already internalized. This bypasses preprocessing
+       and goal2sat, which dominate the cost of small incremental queries.
+    */
+    bool internalize_known_assumptions(unsigned sz, expr* const* asms, dep2asm_t& dep2asm) {
+        unsigned n = sz + get_num_assumptions();
+        for (unsigned i = 0; i < n; ++i) {
+            expr* a = i < sz ? asms[i] : get_assumption(i - sz);
+            expr* atom = a;
+            m.is_not(a, atom);
+            if (!is_uninterp_const(atom) || m_map.to_bool_var(atom) == sat::null_bool_var) {
+                return false;
+            }
+        }
+        for (unsigned i = 0; i < n; ++i) {
+            expr* a = i < sz ? asms[i] : get_assumption(i - sz);
+            expr* atom = a;
+            bool sign = m.is_not(a, atom);
+            sat::bool_var v = m_map.to_bool_var(atom);
+            m_solver.set_eliminated(v, false);
+            dep2asm.insert(a, sat::literal(v, sign));
+        }
+        extract_assumptions(sz, asms, dep2asm);
+        return true;
+    }
+
     lbool internalize_vars(expr_ref_vector const& vars, sat::bool_var_vector& bvars) {
         for (expr* v : vars) {
             internalize_var(v, bvars);
@@ -118,7 +118,7 @@ namespace sat {
 
     typedef approx_set_tpl<literal, literal2unsigned, unsigned> literal_approx_set;
 
-    typedef approx_set_tpl<bool_var, u2u, unsigned> var_approx_set;
+    typedef approx_set_tpl<bool_var, u2u, unsigned long long> var_approx_set;
 
     enum phase {
         POS_PHASE, NEG_PHASE, PHASE_NOT_AVAILABLE
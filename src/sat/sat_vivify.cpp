@@ -0,0 +1,221 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    sat_vivify.cpp
+
+Abstract:
+
+    Vivification of learned clauses.
+
+Revision History:
+
+--*/
+#include "sat/sat_vivify.h"
+#include "sat/sat_simplifier_params.hpp"
+#include "sat/sat_solver.h"
+#include "util/stopwatch.h"
+#include "util/trace.h"
+
+namespace sat {
+
+    vivify::vivify(solver & _s, params_ref const & p):
+        s(_s),
+        m_counter(0),
+        m_calls(0) {
+        updt_params(p);
+        reset_statistics();
+    }
+
+    struct vivify::report {
+        vivify &  m_vivify;
+        stopwatch m_watch;
+        unsigned  m_num_clauses;
+        unsigned  m_elim_literals;
+        report(vivify & v):
+            m_vivify(v),
+            m_num_clauses(v.m_num_clauses),
+            m_elim_literals(v.m_elim_literals) {
+            m_watch.start();
+        }
+
+        ~report() {
+            m_watch.stop();
+            IF_VERBOSE(2,
+                       verbose_stream() << " (sat-vivify :clauses " << (m_vivify.m_num_clauses - m_num_clauses)
+                       << " :elim-literals " << (m_vivify.m_elim_literals - m_elim_literals)
+                       << " :cost " << (m_vivify.m_vivify_limit - m_vivify.m_counter)
+                       << mem_stat()
+                       << m_watch << ")\n";);
+        }
+    };
+
+    // prefer clauses with low glue, then clauses used since the last round.
+    struct vivify::glue_lt {
+        bool operator()(clause const * c1, clause const * c2) const {
+            if (c1->glue() != c2->glue()) return c1->glue() < c2->glue();
+            return c1->was_used() && !c2->was_used();
+        }
+    };
+
+    void vivify::operator()() {
+        ++m_calls;
+        if (!m_vivify || m_calls <= m_vivify_delay)
+            return;
+        s.propagate(false);
+        if (s.m_inconsistent || s.m_learned.empty())
+            return;
+        SASSERT(s.at_base_lvl());
+        CASSERT("vivify", s.check_invariant());
+        report rpt(*this);
+        svector<char> saved_phase(s.m_phase);
+        m_counter = m_vivify_limit;
+
+        clause_vector & clauses = s.m_learned;
+        std::stable_sort(clauses.begin(), clauses.end(), glue_lt());
+        clause_vector::iterator it  = clauses.begin();
+        clause_vector::iterator it2 = it;
+        clause_vector::iterator end = clauses.end();
+        try {
+            for (; it != end; ++it) {
+                clause & c = *(*it);
+                if (m_counter < 0 || s.inconsistent() || c.was_removed() || c.frozen() || c.size() <= 2) {
+                    *it2 = *it;
+                    ++it2;
+                    continue;
+                }
+                s.checkpoint();
+                if (!process(c)) {
+                    continue; // clause was removed
+                }
+                *it2 = *it;
+                ++it2;
+            }
+            clauses.set_end(it2);
+        }
+        catch (solver_exception & ex) {
+            // put m_learned in a consistent state...
+            for (; it != end; ++it, ++it2) {
+                *it2 = *it;
+            }
+            clauses.set_end(it2);
+            s.m_phase = saved_phase;
+            throw ex;
+        }
+        s.m_phase = saved_phase;
+        CASSERT("vivify", s.check_invariant());
+    }
+
+    /**
+       \brief vivify c. Return false if c was removed from the clause database.
+    */
+    bool vivify::process(clause & c) {
+        TRACE("sat_vivify", tout << "processing: " << c << "\n";);
+        SASSERT(s.at_base_lvl());
+        unsigned sz = c.size();
+        for (literal l : c) {
+            if (s.value(l) == l_true) {
+                s.detach_clause(c);
+                s.del_clause(c);
+                return false;
+            }
+        }
+        m_counter -= sz;
+
+        // clause must not be used for propagation
+        scoped_detach scoped_d(s, c);
+        m_lits.reset();
+        s.push();
+        for (unsigned i = 0; i < sz; ++i) {
+            literal l = c[i];
+            lbool val = s.value(l);
+            if (val == l_false) {
+                continue; // ~l is implied by the previous literals
+            }
+            m_lits.push_back(l);
+            if (val == l_true) {
+                break;    // l is implied by the previous literals
+            }
+            unsigned old_sz = s.m_trail.size();
+            s.assign_scoped(~l);
+            s.propagate_core(false); // must not use propagate(), since check_missed_propagation may fail for c
+            m_counter -= s.m_trail.size() - old_sz;
+            if (s.inconsistent()) {
+                break;
+            }
+        }
+        s.pop(1);
+        if (m_lits.size() == sz) {
+            return true;
+        }
+        return re_attach(scoped_d, c);
+    }
+
+    /**
+       \brief move the literals in m_lits, a subsequence of c, to the front of c and shrink it.
+    */
+    bool vivify::re_attach(scoped_detach & scoped_d, clause & c) {
+        VERIFY(s.m_trail.size() == s.m_qhead);
+        unsigned old_sz = c.size();
+        unsigned new_sz = m_lits.size();
+        for (unsigned i = 0, j = 0; i < old_sz && j < new_sz; ++i) {
+            if (c[i] == m_lits[j]) {
+                std::swap(c[i], c[j]);
+                ++j;
+            }
+        }
+        m_elim_literals += old_sz - new_sz;
+        m_num_clauses++;
+        TRACE("sat_vivify", tout << "strengthened to: " << m_lits << "\n";);
+
+        switch (new_sz) {
+        case 0:
+            s.set_conflict();
+            return false;
+        case 1:
+            m_num_deleted++;
+            s.assign_unit(c[0]);
+            s.propagate_core(false);
+            scoped_d.del_clause();
+            return false;
+        case 2:
+            m_num_deleted++;
+            VERIFY(s.value(c[0]) == l_undef && s.value(c[1]) == l_undef);
+            s.mk_bin_clause(c[0], c[1], true);
+            if (s.m_trail.size() > s.m_qhead) s.propagate_core(false);
+            scoped_d.del_clause();
+            return false;
+        default:
+            c.shrink(new_sz);
+            if (c.glue() > new_sz) c.set_glue(new_sz);
+            if (s.m_config.m_drat) {
+                s.m_drat.add(c, true);
+                c.restore(old_sz);
+                s.m_drat.del(c);
+                c.shrink(new_sz);
+            }
+            return true;
+        }
+    }
+
+    void vivify::updt_params(params_ref const & _p) {
+        sat_simplifier_params p(_p);
+        m_vivify       = p.vivify();
+        m_vivify_delay = p.vivify_delay();
+        m_vivify_limit = p.vivify_limit();
+    }
+
+    void vivify::collect_statistics(statistics & st) const {
+        st.update("sat vivify clauses", m_num_clauses);
+        st.update("sat vivify deleted", m_num_deleted);
+        st.update("sat vivify elim literals", m_elim_literals);
+    }
+
+    void vivify::reset_statistics() {
+        m_num_clauses = 0;
+        m_num_deleted = 0;
+        m_elim_literals = 0;
+    }
+
+};
@@ -0,0 +1,68 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    sat_vivify.h
+
+Abstract:
+
+    Vivification of learned clauses.
+
+    For a learned clause l1 \/ ... \/ ln, assign ~l1, ~l2, ... in turn
+    and propagate. If a prefix of the negated literals yields a conflict,
+    or makes a later literal true, the clause is replaced by the prefix
+    (plus that literal). Literals that become false are dropped.
+
+Revision History:
+
+--*/
+#ifndef SAT_VIVIFY_H_
+#define SAT_VIVIFY_H_
+
+#include "sat/sat_types.h"
+#include "util/params.h"
+#include "util/statistics.h"
+
+namespace sat {
+    class solver;
+    class scoped_detach;
+
+    class vivify {
+        struct report;
+        struct glue_lt;
+
+        solver &        s;
+        int64_t         m_counter;      // track cost (literals visited)
+        unsigned        m_calls;
+        literal_vector  m_lits;
+
+        // config
+        bool            m_vivify;
+        unsigned        m_vivify_delay;
+        unsigned        m_vivify_limit;
+
+        // stats
+        unsigned        m_num_clauses;    // clauses strengthened
+        unsigned        m_num_deleted;    // clauses turned into units/binaries or removed
+        unsigned        m_elim_literals;  // literals removed
+
+        bool process(clause & c);
+        bool re_attach(scoped_detach & scoped_d, clause & c);
+
+    public:
+        vivify(solver & s, params_ref const & p);
+
+        void operator()();
+
+        void updt_params(params_ref const & p);
+
+        void collect_statistics(statistics & st) const;
+        void reset_statistics();
+
+        void init_search() { m_calls = 0; }
+    };
+
+};
+
+#endif
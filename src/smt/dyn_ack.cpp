@@ -19,6 +19,7 @@ Revision History:
 #include "smt/smt_context.h"
 #include "smt/dyn_ack.h"
 #include "ast/ast_pp.h"
+#include "util/hash.h"
 
 namespace smt {
 
@@ -126,6 +127,43 @@ namespace smt {
     }
 
 
+    /**
+       \brief Increment the counters of h, and return the estimated number of occurrences.
+       Only the smallest counters are incremented (conservative update), which reduces
+       the overestimation caused by collisions.
+       The counters are multiplied by decay after every c_width * (1 - decay) * threshold / 2
+       events, but not more often than every c_width / 4 events. The sum of the counters
+       of a row then stays below c_width * threshold / 2, so a new key only reaches the
+       threshold if it collides with frequent keys in all rows.
+    */
+    unsigned dyn_ack_manager::occs_sketch::inc(unsigned h, unsigned threshold, double decay) {
+        if (m_counts.empty())
+            m_counts.resize(c_depth * c_width, 0);
+        if (decay < 1.0) {
+            // decaying costs c_depth * c_width, keep it below 16 per event.
+            unsigned period = std::max(c_width / 4, static_cast<unsigned>(c_width * (1.0 - decay) * threshold / 2));
+            if (++m_num_events >= period) {
+                for (unsigned & c : m_counts)
+                    c = static_cast<unsigned>(c * decay);
+                m_num_events = 0;
+            }
+        }
+        unsigned h2  = hash_u(h) | 1;
+        unsigned idx[c_depth];
+        unsigned min = UINT_MAX;
+        for (unsigned i = 0; i < c_depth; i++) {
+            idx[i] = i * c_width + (h + i * h2) % c_width;
+            min = std::min(min, m_counts[idx[i]]);
+        }
+        if (min < UINT_MAX)
+            min++;
+        for (unsigned i = 0; i < c_depth; i++) {
+            if (m_counts[idx[i]] < min)
+                m_counts[idx[i]] = min;
+        }
+        return min;
+    }
+
     void dyn_ack_manager::init_search_eh() {
         m_app_pair2num_occs.reset();
         reset_app_pairs();
@@ -138,6 +176,7 @@ namespace smt {
         reset_app_triples();
         m_triple.m_to_instantiate.reset();
         m_triple.m_qhead = 0;
+        m_sketch.reset();
     }
 
     void dyn_ack_manager::cg_eh(app * n1, app * n2) {
@@ -154,10 +193,19 @@ namespace smt {
         unsigned num_occs = 0;
         if (m_app_pair2num_occs.find(n1, n2, num_occs)) {
             TRACE("dyn_ack", tout << "used_cg_eh:\n" << mk_pp(n1, m_manager) << "\n" << mk_pp(n2, m_manager) << "\nnum_occs: " << num_occs << "\n";);
+            m_stats.m_num_hits++;
             num_occs++;
         }
         else {
-            num_occs = 1;
+            // pairs are tracked exactly only after the sketch estimates
+            // that they reached the threshold.
+            num_occs = m_sketch.inc(hash_u_u(n1->get_id(), n2->get_id()), m_params.m_dack_threshold, m_params.m_dack_gc_inv_decay);
+            if (num_occs < m_params.m_dack_threshold) {
+                m_stats.m_num_misses++;
+                return;
+            }
+            m_stats.m_num_candidates++;
+            num_occs = std::max(m_params.m_dack_threshold, 1u);
             m_manager.inc_ref(n1);
             m_manager.inc_ref(n2);
             m_app_pairs.push_back(p);
@@ -190,10 +238,17 @@ namespace smt {
         if (m_triple.m_app2num_occs.find(n1, n2, r, num_occs)) {
             TRACE("dyn_ack", tout << mk_pp(n1, m_manager) << "\n" << mk_pp(n2, m_manager) 
                   << mk_pp(r, m_manager) << "\n" << "\nnum_occs: " << num_occs << "\n";);
+            m_stats.m_num_hits++;
             num_occs++;
         }
         else {
-            num_occs = 1;
+            num_occs = m_sketch.inc(mk_mix(n1->get_id(), n2->get_id(), r->get_id()), m_params.m_dack_threshold, m_params.m_dack_gc_inv_decay);
+            if (num_occs < m_params.m_dack_threshold) {
+                m_stats.m_num_misses++;
+                return;
+            }
+            m_stats.m_num_candidates++;
+            num_occs = std::max(m_params.m_dack_threshold, 1u);
             m_manager.inc_ref(n1);
             m_manager.inc_ref(n2);
             m_manager.inc_ref(r);
@@ -321,6 +376,7 @@ namespace smt {
         m_num_propagations_since_last_gc++;
         if (m_num_propagations_since_last_gc > m_params.m_dack_gc) {
             gc();
+            gc_triples();
             m_num_propagations_since_last_gc = 0;
         }
         unsigned max_instances  = static_cast<unsigned>(m_context.get_num_conflicts() * m_params.m_dack_factor);
@@ -391,6 +447,12 @@ namespace smt {
         m_triple.m_clause2apps.reset();
     }
 
+    void dyn_ack_manager::collect_statistics(::statistics & st) const {
+        st.update("dyn ack candidates", m_stats.m_num_candidates);
+        st.update("dyn ack hits", m_stats.m_num_hits);
+        st.update("dyn ack misses", m_stats.m_num_misses);
+    }
+
     void dyn_ack_manager::reset_app_triples() {
         svector<app_triple>::iterator it  = m_triple.m_apps.begin();
         svector<app_triple>::iterator end = m_triple.m_apps.end();
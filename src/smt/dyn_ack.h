@@ -24,6 +24,7 @@ Revision History:
 #include "util/obj_hashtable.h"
 #include "util/obj_pair_hashtable.h"
 #include "util/obj_triple_hashtable.h"
+#include "util/statistics.h"
 #include "smt/smt_clause.h"
 
 namespace smt {
@@ -43,6 +44,32 @@ namespace smt {
         typedef obj_triple_hashtable<app, app, app>      app_triple_set;
         typedef obj_map<clause, app_triple>         clause2app_triple;
 
+        /**
+           \brief Count-min sketch of the number of occurrences of pairs and triples
+           that are not tracked exactly. It uses a fixed amount of memory, and may
+           only overestimate the number of occurrences.
+           The counters decay after a number of events that depends on the
+           threshold, so that the sketch does not saturate.
+        */
+        class occs_sketch {
+            static const unsigned c_depth = 4;
+            static const unsigned c_width = 4096;
+            unsigned_vector m_counts; // allocated on first use
+            unsigned        m_num_events;
+        public:
+            occs_sketch(): m_num_events(0) {}
+            unsigned inc(unsigned h, unsigned threshold, double decay);
+            void reset() { m_counts.finalize(); m_num_events = 0; }
+        };
+
+        struct stats {
+            unsigned m_num_candidates;
+            unsigned m_num_hits;
+            unsigned m_num_misses;
+            void reset() { memset(this, 0, sizeof(*this)); }
+            stats() { reset(); }
+        };
+
         context &                                  m_context;
         ast_manager &                              m_manager;
         dyn_ack_params &                           m_params;
@@ -66,6 +93,8 @@ namespace smt {
             clause2app_triple                      m_clause2apps;
         };
         _triple                                    m_triple;
+        occs_sketch                                m_sketch;
+        stats                                      m_stats;
         
 
 
@@ -126,6 +155,15 @@ namespace smt {
 
         void reset();
 
+        void collect_statistics(::statistics & st) const;
+
+        unsigned get_num_misses() const { return m_stats.m_num_misses; }
+
+        /**
+           \brief Return the number of pairs and triples whose occurrences are tracked exactly.
+        */
+        unsigned get_num_tracked() const { return m_app_pairs.size() + m_triple.m_apps.size(); }
+
 #ifdef Z3DEBUG
         bool check_invariant() const;
 #endif
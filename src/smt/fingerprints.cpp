@@ -20,14 +20,20 @@ Revision History:
 
 namespace smt {
 
-    fingerprint::fingerprint(region & r, void * d, unsigned d_h, expr* def, unsigned n, enode * const * args):
+    fingerprint::fingerprint(void * d, unsigned d_h, expr* def, unsigned n, enode * const * args):
         m_data(d), 
         m_data_hash(d_h),
         m_def(def),
-        m_num_args(n), 
-        m_args(nullptr) {
-        m_args = new (r) enode*[n];
-        memcpy(m_args, args, sizeof(enode*) * n);
+        m_num_args(n) {
+        memcpy(this->args(), args, sizeof(enode*) * n);
+    }
+
+    fingerprint * fingerprint::mk(region & r, void * d, unsigned d_h, expr* def, unsigned n, enode * const * args) {
+        return mk(r.allocate(get_obj_size(n)), d, d_h, def, n, args);
+    }
+
+    fingerprint * fingerprint::mk(void * mem, void * d, unsigned d_h, expr* def, unsigned n, enode * const * args) {
+        return new (mem) fingerprint(d, d_h, def, n, args);
     }
 
     bool fingerprint_set::fingerprint_eq_proc::operator()(fingerprint const * f1, fingerprint const * f2) const {
@@ -43,13 +49,9 @@ namespace smt {
     }
 
     fingerprint * fingerprint_set::mk_dummy(void * data, unsigned data_hash, unsigned num_args, enode * const * args) {
-        m_tmp.reset();
-        m_tmp.append(num_args, args);
-        m_dummy.m_data      = data;
-        m_dummy.m_data_hash = data_hash;
-        m_dummy.m_num_args  = num_args;
-        m_dummy.m_args      = m_tmp.c_ptr();
-        return &m_dummy;
+        unsigned sz = (fingerprint::get_obj_size(num_args) + sizeof(void*) - 1) / sizeof(void*);
+        m_dummy.reserve(sz);
+        return fingerprint::mk(m_dummy.c_ptr(), data, data_hash, nullptr, num_args, args);
     }
 
     std::ostream& operator<<(std::ostream& out, fingerprint const& f) {
@@ -69,16 +71,15 @@ namespace smt {
         TRACE("fingerprint_bug", tout << "1) inserting: " << data_hash << " num_args: " << num_args;
               for (unsigned i = 0; i < num_args; i++) tout << " " << args[i]->get_owner_id(); 
               tout << "\n";);
-        for (unsigned i = 0; i < num_args; i++)
-            d->m_args[i] = d->m_args[i]->get_root();
-        if (m_set.contains(d)) {
+        // the second lookup is only needed if some argument is not a root.
+        if (to_roots(d) && m_set.contains(d)) {
             TRACE("fingerprint_bug", tout << "failed: " << data_hash << " num_args: " << num_args;
-                  for (unsigned i = 0; i < num_args; i++) tout << " " << d->m_args[i]->get_owner_id(); 
+                  for (unsigned i = 0; i < num_args; i++) tout << " " << d->get_arg(i)->get_owner_id(); 
                   tout << "\n";);
             return nullptr;
         }
         TRACE("fingerprint_bug", tout << "2) inserting: " << *d;);
-        fingerprint * f = new (m_region) fingerprint(m_region, data, data_hash, def, num_args, d->m_args);
+        fingerprint * f = fingerprint::mk(m_region, data, data_hash, def, num_args, d->get_args());
         m_fingerprints.push_back(f);
         m_defs.push_back(def);
         m_set.insert(f);
@@ -89,11 +90,18 @@ namespace smt {
         fingerprint * d = mk_dummy(data, data_hash, num_args, args);
         if (m_set.contains(d)) 
             return true;
-        for (unsigned i = 0; i < num_args; i++)
-            d->m_args[i] = d->m_args[i]->get_root();
-        if (m_set.contains(d))
-            return true;
-        return false;
+        return to_roots(d) && m_set.contains(d);
+    }
+
+    bool fingerprint_set::to_roots(fingerprint * d) {
+        bool changed = false;
+        enode * * args = d->args();
+        for (unsigned i = 0; i < d->m_num_args; i++) {
+            enode * r = args[i]->get_root();
+            changed |= r != args[i];
+            args[i] = r;
+        }
+        return changed;
     }
     
     void fingerprint_set::reset() {
@@ -127,6 +135,14 @@ namespace smt {
         }
     }
 
+    void fingerprint_set::collect_statistics(::statistics & st) const {
+        size_t bytes = m_set.capacity() * sizeof(set::entry) + m_fingerprints.capacity() * sizeof(fingerprint*);
+        for (fingerprint const * f : m_fingerprints) 
+            bytes += fingerprint::get_obj_size(f->get_num_args());
+        st.update("fingerprints", m_fingerprints.size());
+        st.update("fingerprint memory", static_cast<double>(bytes) / (1024.0 * 1024.0));
+    }
+
 #ifdef Z3DEBUG
     /**
        \brief Slow function for checking if there is a fingerprint congruent to (data args[0] ... args[num_args-1])
@@ -21,6 +21,7 @@ Revision History:
 
 #include "smt/smt_enode.h"
 #include "util/util.h"
+#include "util/statistics.h"
 
 namespace smt {
 
@@ -30,19 +31,22 @@ namespace smt {
         unsigned      m_data_hash;
         expr*         m_def;
         unsigned      m_num_args;
-        enode * *     m_args;
 
         friend class fingerprint_set;
-        fingerprint() {}
+        // the arguments are stored inline, right after the fingerprint.
+        fingerprint(void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
+        static fingerprint * mk(region & r, void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
+        static fingerprint * mk(void * mem, void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
+        static unsigned get_obj_size(unsigned n) { return sizeof(fingerprint) + sizeof(enode*) * n; }
+        enode * * args() { return reinterpret_cast<enode**>(this + 1); }
     public:
-        fingerprint(region & r, void * d, unsigned d_hash, expr* def, unsigned n, enode * const * args);
         void * get_data() const { return m_data; }
         expr * get_def() const { return m_def; }
         unsigned get_data_hash() const { return m_data_hash; }
         unsigned get_num_args() const { return m_num_args;  }
-        enode * const * get_args() const { return m_args; }
-        enode * get_arg(unsigned idx) const { SASSERT(idx < m_num_args); return m_args[idx]; }
-        enode * const * begin() const { return m_args; }
+        enode * const * get_args() const { return reinterpret_cast<enode * const *>(this + 1); }
+        enode * get_arg(unsigned idx) const { SASSERT(idx < m_num_args); return get_args()[idx]; }
+        enode * const * begin() const { return get_args(); }
         enode * const * end() const { return begin() + get_num_args(); }
         friend std::ostream& operator<<(std::ostream& out, fingerprint const& f);
     };
@@ -68,10 +72,10 @@ namespace smt {
         ptr_vector<fingerprint>  m_fingerprints;
         expr_ref_vector          m_defs;
         unsigned_vector          m_scopes;
-        ptr_vector<enode>        m_tmp;
-        fingerprint              m_dummy;
+        ptr_vector<void>         m_dummy; // buffer for a fingerprint used in lookups
 
         fingerprint * mk_dummy(void * data, unsigned data_hash, unsigned num_args, enode * const * args);
+        bool to_roots(fingerprint * d);
 
     public:
         fingerprint_set(ast_manager& m, region & r): m_region(r), m_defs(m) {}
@@ -82,6 +86,7 @@ namespace smt {
         void push_scope();
         void pop_scope(unsigned num_scopes);
         void display(std::ostream & out) const;
+        void collect_statistics(::statistics & st) const;
 #ifdef Z3DEBUG
         bool slow_contains(void const * data, unsigned data_hash, unsigned num_args, enode * const * args) const;
 #endif
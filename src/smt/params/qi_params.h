@@ -50,6 +50,7 @@ struct qi_params {
     unsigned           m_mbqi_max_iterations;
     bool               m_mbqi_trace;
     unsigned           m_mbqi_force_template;
+    bool               m_mbqi_cache;
     const char *       m_mbqi_id;
 
     qi_params(params_ref const & p = params_ref()):
@@ -98,6 +99,7 @@ struct qi_params {
         m_mbqi_max_iterations(1000),
         m_mbqi_trace(false),
         m_mbqi_force_template(10),
+        m_mbqi_cache(true),
         m_mbqi_id(nullptr)
     {
         updt_params(p);
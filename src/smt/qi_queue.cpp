@@ -148,6 +148,10 @@ namespace smt {
     }
 
     void qi_queue::instantiate() {
+        if (m_new_entries.empty())
+            return;
+        stopwatch sw;
+        sw.start();
         unsigned since_last_check = 0;
         for (entry & curr : m_new_entries) {
             fingerprint * f    = curr.m_qb;
@@ -175,6 +179,12 @@ namespace smt {
             }
         }
         m_new_entries.reset();
+        sw.stop();
+        double secs = sw.get_seconds();
+        m_stats.m_num_rounds++;
+        m_stats.m_round_time += secs;
+        if (secs > m_stats.m_max_round_time)
+            m_stats.m_max_round_time = secs;
         TRACE("new_entries_bug", tout << "[qi:instantiate]\n";);
     }
 
@@ -450,6 +460,9 @@ namespace smt {
     void qi_queue::collect_statistics(::statistics & st) const {
         st.update("quant instantiations", m_stats.m_num_instances);
         st.update("lazy quant instantiations", m_stats.m_num_lazy_instances);
+        st.update("quant instantiation rounds", m_stats.m_num_rounds);
+        st.update("quant instantiation time", m_stats.m_round_time);
+        st.update("quant instantiation max round time", m_stats.m_max_round_time);
         st.update("missed quant instantiations", m_delayed_entries.size());
         float min, max;
         get_min_max_costs(min, max);
@@ -29,12 +29,16 @@ Revision History:
 #include "smt/cost_evaluator.h"
 #include "smt/cached_var_subst.h"
 #include "util/statistics.h"
+#include "util/stopwatch.h"
 
 namespace smt {
     class context;
 
     struct qi_queue_stats {
         unsigned m_num_instances, m_num_lazy_instances;
+        unsigned m_num_rounds;      //!< number of non-empty calls to instantiate()
+        double   m_round_time;      //!< total seconds spent in instantiate()
+        double   m_max_round_time;  //!< latency of the slowest round
         void reset() { memset(this, 0, sizeof(qi_queue_stats)); }
         qi_queue_stats() { reset(); }
     };
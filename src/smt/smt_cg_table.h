@@ -178,7 +178,9 @@ namespace smt {
                 unsigned h2 = n->get_arg(1)->get_root()->hash();
                 if (h1 > h2)
                     std::swap(h1, h2);
-                return hash_u((h1 << 16) | (h2 & 0xFFFF));
+                // keep all bits of both hashes; truncating to 16 bits each
+                // causes collisions when there are many arguments.
+                return combine_hash(h1, h2);
             }
         };
         
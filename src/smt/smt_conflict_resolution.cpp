@@ -44,6 +44,8 @@ namespace smt {
         m_lemma_atoms(m),
         m_todo_js_qhead(0),
         m_antecedents(nullptr),
+        m_num_explained_eqs(0),
+        m_num_reused_eqs(0),
         m_watches(watches),
         m_new_proofs(m),
         m_lemma_proof(m)
@@ -153,12 +155,17 @@ namespace smt {
 
        The resultant set of literals is stored in m_antecedents.
     */
-    void conflict_resolution::eq_branch2literals(enode * n1, enode * n2) {
+    bool conflict_resolution::eq_branch2literals(enode * n1, enode * n2) {
         SASSERT(n1->trans_reaches(n2));
+        bool only_literals = true;
         while (n1 != n2) {
-            eq_justification2literals(n1, n1->m_trans.m_target, n1->m_trans.m_justification);
+            eq_justification js = n1->m_trans.m_justification;
+            if (js.get_kind() != eq_justification::AXIOM && js.get_kind() != eq_justification::EQUATION)
+                only_literals = false;
+            eq_justification2literals(n1, n1->m_trans.m_target, js);
             n1 = n1->m_trans.m_target;
         }
+        return only_literals;
     }
 
     /**
@@ -169,10 +176,82 @@ namespace smt {
        The resultant set of literals is stored in m_antecedents.
     */
     void conflict_resolution::eq2literals(enode * n1, enode * n2) {
+        if (explain_from_cache(n1, n2))
+            return;
+        unsigned old_sz = m_antecedents->size();
         enode * c = find_common_ancestor(n1, n2);
-        eq_branch2literals(n1, c);
-        eq_branch2literals(n2, c);
+        bool only_literals1 = eq_branch2literals(n1, c);
+        bool only_literals2 = eq_branch2literals(n2, c);
         m_dyn_ack_manager.used_eq_eh(n1->get_owner(), n2->get_owner(), c->get_owner());
+        if (only_literals1 && only_literals2)
+            cache_explanation(n1, n2, c, old_sz);
+    }
+
+    /**
+       \brief Use the cached explanation of n1 = n2 if there is one.
+    */
+    bool conflict_resolution::explain_from_cache(enode * n1, enode * n2) {
+        if (n1->get_owner_id() > n2->get_owner_id())
+            std::swap(n1, n2);
+        explained_eq * e = nullptr;
+        if (!m_eq2explanation.find(n1, n2, e))
+            return false;
+        m_num_reused_eqs++;
+        m_antecedents->append(e->m_lits);
+        m_dyn_ack_manager.used_eq_eh(n1->get_owner(), n2->get_owner(), e->m_ancestor->get_owner());
+        return true;
+    }
+
+    /**
+       \brief Store the literals at positions [old_sz, m_antecedents->size()) as the
+       explanation of n1 = n2. Proof generation walks the transitivity 'proofs' directly,
+       so explanations are not cached when proofs are enabled.
+    */
+    void conflict_resolution::cache_explanation(enode * n1, enode * n2, enode * c, unsigned old_sz) {
+        if (m_manager.proofs_enabled())
+            return;
+        if (n1->get_owner_id() > n2->get_owner_id())
+            std::swap(n1, n2);
+        unsigned lvl = std::max(c->get_iscope_lvl(), std::max(n1->get_iscope_lvl(), n2->get_iscope_lvl()));
+        explained_eq * e = alloc(explained_eq);
+        e->m_ancestor = c;
+        for (unsigned i = old_sz; i < m_antecedents->size(); ++i) {
+            literal l = (*m_antecedents)[i];
+            lvl = std::max(lvl, m_ctx.get_assign_level(l));
+            e->m_lits.push_back(l);
+        }
+        SASSERT(lvl <= m_ctx.get_scope_level());
+        if (lvl >= m_explained_eqs.size())
+            m_explained_eqs.resize(lvl + 1);
+        m_explained_eqs[lvl].push_back(enode_pair(n1, n2));
+        m_eq2explanation.insert(n1, n2, e);
+        m_num_explained_eqs++;
+    }
+
+    void conflict_resolution::pop_scope_eh(unsigned num_scopes) {
+        unsigned new_lvl = m_ctx.get_scope_level() - num_scopes;
+        for (unsigned lvl = new_lvl + 1; lvl < m_explained_eqs.size(); ++lvl) {
+            for (enode_pair const & p : m_explained_eqs[lvl]) {
+                explained_eq * e = nullptr;
+                VERIFY(m_eq2explanation.find(p.first, p.second, e));
+                dealloc(e);
+                m_eq2explanation.erase(p.first, p.second);
+            }
+        }
+        if (new_lvl + 1 < m_explained_eqs.size())
+            m_explained_eqs.shrink(new_lvl + 1);
+    }
+
+    void conflict_resolution::reset_explanations() {
+        for (auto const & kv : m_eq2explanation)
+            dealloc(kv.get_value());
+        m_eq2explanation.reset();
+        m_explained_eqs.reset();
+    }
+
+    void conflict_resolution::collect_statistics(::statistics & st) const {
+        st.update("cr explained eqs", m_num_explained_eqs);
+        st.update("cr reused eqs", m_num_reused_eqs);
     }
 
     /**
@@ -30,6 +30,7 @@ Revision History:
 #include "util/map.h"
 #include "smt/watch_list.h"
 #include "util/obj_pair_set.h"
+#include "util/statistics.h"
 
 typedef approx_set_tpl<unsigned, u2u, unsigned> level_approx_set;
 
@@ -65,6 +66,27 @@ namespace smt {
         
         literal_vector *               m_antecedents;
 
+        // ---------------------------
+        //
+        // Explanation cache
+        //
+        // Equalities whose transitivity 'proof' only uses asserted equations
+        // are explained by a set of literals that remains valid while the
+        // literals are assigned and the enodes are alive.
+        // An entry is stored at the maximum of these scope levels, and it is
+        // discarded when that scope is backtracked.
+        //
+        // ---------------------------
+        struct explained_eq {
+            enode *                    m_ancestor;
+            literal_vector             m_lits;
+        };
+        typedef obj_pair_map<enode, enode, explained_eq *> eq2explanation;
+        eq2explanation                 m_eq2explanation;
+        vector<svector<enode_pair> >   m_explained_eqs; // per scope level
+        unsigned                       m_num_explained_eqs;
+        unsigned                       m_num_reused_eqs;
+
         // Reference for watch lists are used to implement subsumption resolution
         vector<watch_list> &           m_watches;     //!< per literal
 
@@ -165,8 +187,11 @@ namespace smt {
         void mark_enodes_in_trans(enode * n);
         enode * find_common_ancestor(enode * n1, enode * n2);
         void eq_justification2literals(enode * lhs, enode * rhs, eq_justification js);
-        void eq_branch2literals(enode * n1, enode * n2);
+        bool eq_branch2literals(enode * n1, enode * n2);
         void eq2literals(enode * n1, enode * n2);
+        bool explain_from_cache(enode * n1, enode * n2);
+        void cache_explanation(enode * n1, enode * n2, enode * c, unsigned old_sz);
+        void reset_explanations();
         void justification2literals_core(justification * js, literal_vector & result) ;
         void process_justifications();
         void unmark_justifications(unsigned old_js_qhead);
@@ -208,7 +233,7 @@ namespace smt {
                             vector<watch_list> & watches
                             );
 
-        virtual ~conflict_resolution() {}
+        virtual ~conflict_resolution() { reset_explanations(); }
 
         virtual bool resolve(b_justification conflict, literal not_l);
 
@@ -260,6 +285,13 @@ namespace smt {
 
         void eq2literals(enode * n1, enode * n2, literal_vector & result);
 
+        /**
+           \brief Discard cached explanations that depend on the backtracked scopes.
+        */
+        void pop_scope_eh(unsigned num_scopes);
+
+        void collect_statistics(::statistics & st) const;
+
     };
 
     inline void mark_literals(conflict_resolution & cr, unsigned sz, literal const * ls) {
@@ -38,6 +38,7 @@ Revision History:
 #include "ast/ast_smt2_pp.h"
 #include "ast/ast_translation.h"
 #include "ast/recfun_decl_plugin.h"
+#include "smt/smt_parallel.h"
 
 namespace smt {
 
@@ -2433,6 +2434,7 @@ namespace smt {
             del_clauses(m_aux_clauses, s.m_aux_clauses_lim);
 
             m_relevancy_propagator->pop(num_scopes);
+            m_conflict_resolution->pop_scope_eh(num_scopes);
 
             m_fingerprints.pop_scope(num_scopes);
             unassign_vars(s.m_assigned_literals_lim);
@@ -3379,6 +3381,12 @@ namespace smt {
             return check(0, nullptr, reset_cancel);
         }
 
+        if (m_fparams.m_threads > 1) {
+            parallel p(*this);
+            expr_ref_vector asms(m_manager);
+            return p(asms);
+        }
+
         internalize_assertions();
         TRACE("before_search", display(tout););
         lbool r = search();
@@ -3431,6 +3439,11 @@ namespace smt {
     }
 
     lbool context::check(unsigned num_assumptions, expr * const * assumptions, bool reset_cancel) {
+        if (m_fparams.m_threads > 1) {
+            parallel p(*this);
+            expr_ref_vector asms(m_manager, num_assumptions, assumptions);
+            return p(asms);
+        }
         if (!check_preamble(reset_cancel)) return l_undef;
         SASSERT(at_base_level());
         setup_context(false);
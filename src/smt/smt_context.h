@@ -67,8 +67,10 @@ namespace smt {
 
     class context {
         friend class model_generator;
+        friend class parallel;
     public:
         statistics                  m_stats;
+        ::statistics                m_aux_stats; //!< statistics of worker contexts in parallel mode.
 
         std::ostream& display_last_failure(std::ostream& out) const;
         std::string last_failure_as_string() const;
@@ -390,11 +390,16 @@ namespace smt {
         st.update("backwd subs res", m_stats.m_num_bsr);
         st.update("frwrd subs res", m_stats.m_num_fsr);
 #endif
+        m_fingerprints.collect_statistics(st);
+        m_relevancy_propagator->collect_statistics(st);
+        m_dyn_ack_manager.collect_statistics(st);
+        m_conflict_resolution->collect_statistics(st);
         m_qmanager->collect_statistics(st);
         m_asserted_formulas.collect_statistics(st);
         for (theory* th : m_theory_set) {
             th->collect_statistics(st);
         }
+        st.copy(m_aux_stats);
     }
 
     void context::display_statistics(std::ostream & out) const {
@@ -49,6 +49,10 @@ namespace smt {
         m_iteration_idx(0),
         m_has_rec_fun(false),
         m_curr_model(nullptr),
+        m_valid_bodies(m),
+        m_valid_qs(m),
+        m_num_checks(0),
+        m_num_cached_checks(0),
         m_pinned_exprs(m) {
     }
 
@@ -135,9 +139,8 @@ namespace smt {
        The variables are replaced by skolem constants. These constants are stored in sks.
     */
 
-    void model_checker::assert_neg_q_m(quantifier * q, expr_ref_vector & sks) {
-        expr_ref tmp(m);
-        if (!m_curr_model->eval(q->get_expr(), tmp, true)) {
+    void model_checker::assert_neg_q_m(quantifier * q, expr * tmp, expr_ref_vector & sks) {
+        if (!tmp) {
             return;
         }
         TRACE("model_checker", tout << "q after applying interpretation:\n" << mk_ismt2_pp(tmp, m) << "\n";);
@@ -292,24 +295,69 @@ namespace smt {
         ~scoped_ctx_push() { c->pop(1); }
     };
 
+    /**
+       \brief Return true if the universe of some variable of q is restricted
+       by m_curr_model. The check of q then depends on more than its body.
+    */
+    bool model_checker::has_finite_sort(quantifier * q) const {
+        for (unsigned i = 0; i < q->get_num_decls(); ++i) {
+            if (m_curr_model->is_finite(q->get_decl_sort(i)))
+                return true;
+        }
+        return false;
+    }
+
+    bool model_checker::is_known_valid(quantifier * q, expr * body) const {
+        unsigned idx;
+        return m_q2valid_body.find(q, idx) && m_valid_bodies.get(idx) == body;
+    }
+
+    void model_checker::set_known_valid(quantifier * q, expr * body) {
+        unsigned idx;
+        if (m_q2valid_body.find(q, idx)) {
+            m_valid_bodies[idx] = body;
+        }
+        else {
+            m_q2valid_body.insert(q, m_valid_bodies.size());
+            m_valid_bodies.push_back(body);
+            m_valid_qs.push_back(q);
+        }
+    }
+
     /**
        \brief Return true if q is satisfied by m_curr_model.
     */
     bool model_checker::check(quantifier * q) {
         SASSERT(!m_aux_context->relevancy());
-        scoped_ctx_push _push(m_aux_context.get());
-
         quantifier * flat_q = get_flat_quantifier(q);
         TRACE("model_checker", tout << "model checking:\n" << expr_ref(q->get_expr(), m) << "\n" << expr_ref(flat_q->get_expr(), m) << "\n";);
+        m_num_checks++;
+
+        expr_ref body(m);
+        if (!m_curr_model->eval(flat_q->get_expr(), body, true)) {
+            body = nullptr;
+        }
+        // the auxiliary problem is the negated body over fresh constants,
+        // so a body that was valid before is still valid.
+        bool cacheable = m_params.m_mbqi_cache && body && !has_finite_sort(flat_q);
+        if (cacheable && is_known_valid(flat_q, body)) {
+            m_num_cached_checks++;
+            return true;
+        }
+
+        scoped_ctx_push _push(m_aux_context.get());
         expr_ref_vector sks(m);
 
-        assert_neg_q_m(flat_q, sks);
+        assert_neg_q_m(flat_q, body, sks);
         TRACE("model_checker", tout << "skolems:\n" << sks << "\n";);
 
         flet<bool> l(m_aux_context->get_fparams().m_array_fake_support, true);
         lbool r = m_aux_context->check();
         TRACE("model_checker", tout << "[complete] model-checker result: " << to_sat_str(r) << "\n";);
         if (r != l_true) {            
+            if (r == l_false && cacheable) {
+                set_known_valid(flat_q, body);
+            }
             return r == l_false; // quantifier is satisfied by m_curr_model
         }
 
@@ -554,6 +602,14 @@ namespace smt {
 
     void model_checker::reset() {
         reset_new_instances();
+        m_q2valid_body.reset();
+        m_valid_bodies.reset();
+        m_valid_qs.reset();
+    }
+
+    void model_checker::collect_statistics(::statistics & st) const {
+        st.update("mbqi checks", m_num_checks);
+        st.update("mbqi cached checks", m_num_cached_checks);
     }
 
     void model_checker::assert_new_instances() {
@@ -22,6 +22,7 @@ Revision History:
 #define SMT_MODEL_CHECKER_H_
 
 #include "util/obj_hashtable.h"
+#include "util/statistics.h"
 #include "ast/ast.h"
 #include "ast/array_decl_plugin.h"
 #include "ast/normal_forms/defined_names.h"
@@ -54,6 +55,12 @@ namespace smt {
         bool                                        m_has_rec_fun;
         proto_model *                               m_curr_model;
         obj_map<expr, expr *>                       m_value2expr;
+        // bodies, under the model interpretation, that were found valid in a previous round.
+        obj_map<quantifier, unsigned>               m_q2valid_body;
+        expr_ref_vector                             m_valid_bodies;
+        expr_ref_vector                             m_valid_qs;
+        unsigned                                    m_num_checks;
+        unsigned                                    m_num_cached_checks;
 
         friend class instantiation_set;
 
@@ -62,7 +69,10 @@ namespace smt {
         expr * get_term_from_ctx(expr * val);
         expr_ref replace_value_from_ctx(expr * e);
         void restrict_to_universe(expr * sk, obj_hashtable<expr> const & universe);
-        void assert_neg_q_m(quantifier * q, expr_ref_vector & sks);
+        void assert_neg_q_m(quantifier * q, expr * body, expr_ref_vector & sks);
+        bool has_finite_sort(quantifier * q) const;
+        bool is_known_valid(quantifier * q, expr * body) const;
+        void set_known_valid(quantifier * q, expr * body);
         bool add_blocking_clause(model * cex, expr_ref_vector & sks);
         bool check(quantifier * q);
         bool check_rec_fun(quantifier* q, bool strict_rec_fun);
@@ -104,6 +114,8 @@ namespace smt {
 
         void reset();
 
+        void collect_statistics(::statistics & st) const;
+
         void operator()(expr* e);
 
     };
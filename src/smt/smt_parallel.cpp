@@ -0,0 +1,253 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    smt_parallel.cpp
+
+Abstract:
+
+    Parallel SMT, portfolio and cube-and-conquer.
+
+--*/
+#include <thread>
+#include <mutex>
+#include "util/scoped_ptr_vector.h"
+#include "ast/ast_util.h"
+#include "ast/ast_translation.h"
+#include "ast/for_each_expr.h"
+#include "smt/smt_parallel.h"
+
+namespace smt {
+
+    namespace {
+        struct found_skolem {};
+        struct skolem_proc {
+            void operator()(var * n) const {}
+            void operator()(app const * n) const { if (n->get_decl()->is_skolem()) throw found_skolem(); }
+            void operator()(quantifier * n) const {}
+        };
+    }
+
+    /**
+       \brief Units are only exchanged if they do not mention fresh symbols.
+       Fresh symbols are local to the worker that introduced them and may
+       clash by name with fresh symbols of other workers.
+    */
+    static bool is_shareable(expr * e) {
+        skolem_proc p;
+        try {
+            for_each_expr(p, e);
+        }
+        catch (const found_skolem &) {
+            return false;
+        }
+        return true;
+    }
+
+    lbool parallel::operator()(expr_ref_vector const& asms) {
+        ast_manager& m = ctx.get_manager();
+        smt_params& fp = ctx.get_fparams();
+        unsigned num_threads = fp.m_threads;
+        flet<unsigned> _nt(fp.m_threads, 1);
+
+        if (num_threads <= 1 || ctx.m_base_lvl > 0 || m.proofs_enabled() || m.has_trace_stream()) {
+            return ctx.check(asms.size(), asms.c_ptr());
+        }
+
+        unsigned thread_max_conflicts = fp.m_threads_max_conflicts;
+        unsigned max_conflicts = fp.m_max_conflicts;
+
+        // easy problems are solved sequentially before paying for the copies.
+        {
+            flet<unsigned> _mc(fp.m_max_conflicts, std::min(thread_max_conflicts, max_conflicts));
+            lbool r = ctx.check(asms.size(), asms.c_ptr());
+            if (r != l_undef || ctx.m_last_search_failure != NUM_CONFLICTS || max_conflicts <= thread_max_conflicts) {
+                return r;
+            }
+            max_conflicts -= thread_max_conflicts;
+        }
+
+        scoped_ptr_vector<ast_manager> pms;
+        scoped_ptr_vector<smt_params>  pparams;
+        scoped_ptr_vector<context>     pctxs;
+        vector<expr_ref_vector>        pasms;
+        scoped_limits sl(m.limit());
+        for (unsigned i = 0; i < num_threads; ++i) {
+            ast_manager* new_m = alloc(ast_manager, m, true);
+            pms.push_back(new_m);
+            smt_params* new_p = alloc(smt_params, fp);
+            new_p->m_random_seed = fp.m_random_seed + i;
+            pparams.push_back(new_p);
+            context* new_ctx = alloc(context, *new_m, *new_p, ctx.get_params());
+            pctxs.push_back(new_ctx);
+            context::copy(ctx, *new_ctx);
+            ast_translation tr(m, *new_m);
+            expr_ref_vector new_asms(*new_m);
+            for (expr* a : asms) {
+                new_asms.push_back(tr(a));
+            }
+            pasms.push_back(new_asms);
+            sl.push_child(&(new_m->limit()));
+        }
+
+        std::mutex mux;
+        lbool result = l_undef;
+        unsigned finished_id = UINT_MAX;
+        unsigned num_rounds = 0;
+        unsigned error_code = 0;
+        std::string ex_msg;
+        bool has_exception = false;
+
+        auto worker_thread = [&](unsigned i) {
+            try {
+                context& pctx = *pctxs[i];
+                ast_manager& pm = *pms[i];
+                expr_ref_vector lasms(pasms[i]);
+                expr_ref c(pm);
+                pctx.get_fparams().m_max_conflicts = std::min(thread_max_conflicts, max_conflicts);
+                if (num_rounds > 0) {
+                    // split on the next case split of this worker, siblings take opposite phases.
+                    pctx.pop_to_base_lvl();
+                    c = pctx.next_decision();
+                    if (pm.is_true(c)) {
+                        c = nullptr;
+                    }
+                    else {
+                        if (i % 2 == 1) c = pm.mk_not(c);
+                        lasms.push_back(c);
+                    }
+                }
+                lbool r = pctx.check(lasms.size(), lasms.c_ptr());
+                if (r == l_undef && pctx.m_last_search_failure == NUM_CONFLICTS && max_conflicts > thread_max_conflicts) {
+                    return;
+                }
+                if (r == l_false && c && pctx.m_unsat_core.contains(c)) {
+                    // the cube is refuted, keep the negated core as a lemma.
+                    expr_ref lemma(mk_not(mk_and(pctx.m_unsat_core)), pm);
+                    pctx.pop_to_base_lvl();
+                    pctx.assert_expr(lemma);
+                    return;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mux);
+                    if (finished_id != UINT_MAX) {
+                        return;
+                    }
+                    finished_id = i;
+                    result = r;
+                }
+                for (unsigned j = 0; j < num_threads; ++j) {
+                    if (j != i) pms[j]->limit().cancel();
+                }
+            }
+            catch (z3_error & err) {
+                std::lock_guard<std::mutex> lock(mux);
+                error_code = err.error_code();
+                has_exception = true;
+            }
+            catch (z3_exception & ex) {
+                std::lock_guard<std::mutex> lock(mux);
+                ex_msg = ex.msg();
+                has_exception = true;
+            }
+        };
+
+        obj_hashtable<expr> unit_set;
+        expr_ref_vector unit_trail(m);
+        unsigned_vector unit_lim(num_threads, 0u);    // position in the worker's trail
+        unsigned_vector unit_shared(num_threads, 0u); // position in unit_trail sent to the worker
+
+        auto collect_units = [&]() {
+            for (unsigned i = 0; i < num_threads; ++i) {
+                context& pctx = *pctxs[i];
+                ast_manager& pm = pctx.get_manager();
+                pctx.pop_to_base_lvl();
+                ast_translation tr(pm, m, false);
+                unsigned sz = pctx.assigned_literals().size();
+                for (unsigned j = std::min(unit_lim[i], sz); j < sz; ++j) {
+                    literal lit = pctx.assigned_literals()[j];
+                    expr_ref e(pctx.bool_var2expr(lit.var()), pm);
+                    if (!is_shareable(e)) continue;
+                    if (lit.sign()) e = pm.mk_not(e);
+                    expr_ref ce(tr(e.get()), m);
+                    if (!unit_set.contains(ce)) {
+                        unit_set.insert(ce);
+                        unit_trail.push_back(ce);
+                    }
+                }
+                unit_lim[i] = sz;
+            }
+            for (unsigned i = 0; i < num_threads; ++i) {
+                context& pctx = *pctxs[i];
+                ast_translation tr(m, pctx.get_manager(), false);
+                for (unsigned j = unit_shared[i]; j < unit_trail.size(); ++j) {
+                    pctx.assert_expr(tr(unit_trail.get(j)));
+                }
+                unit_shared[i] = unit_trail.size();
+            }
+            IF_VERBOSE(1, verbose_stream() << "(smt.parallel :round " << num_rounds << " :units " << unit_trail.size() << ")\n";);
+        };
+
+        while (true) {
+            vector<std::thread> threads;
+            for (unsigned i = 0; i < num_threads; ++i) {
+                threads.push_back(std::thread([&, i]() { worker_thread(i); }));
+            }
+            for (auto & th : threads) {
+                th.join();
+            }
+            if (finished_id != UINT_MAX || has_exception) {
+                break;
+            }
+            collect_units();
+            ++num_rounds;
+            max_conflicts = (max_conflicts < thread_max_conflicts) ? 0 : (max_conflicts - thread_max_conflicts);
+            thread_max_conflicts *= 2;
+        }
+
+        for (unsigned i = 0; i < num_threads; ++i) {
+            pctxs[i]->collect_statistics(ctx.m_aux_stats);
+        }
+
+        if (finished_id == UINT_MAX) {
+            if (error_code != 0) {
+                throw z3_error(error_code);
+            }
+            throw default_exception(ex_msg.c_str());
+        }
+
+        context& pctx = *pctxs[finished_id];
+        ast_translation tr(*pms[finished_id], m);
+        switch (result) {
+        case l_true: {
+            model_ref mdl;
+            pctx.get_model(mdl);
+            ctx.m_model = mdl ? mdl->translate(tr) : nullptr;
+            break;
+        }
+        case l_false: {
+            // fresh constants are not translated back to the original constants,
+            // so the core is mapped back through the assumptions.
+            obj_map<expr, expr*> asm2orig;
+            for (unsigned j = 0; j < asms.size(); ++j) {
+                asm2orig.insert(pasms[finished_id].get(j), asms[j]);
+            }
+            ctx.m_unsat_core.reset();
+            for (expr* e : pctx.m_unsat_core) {
+                expr* a = nullptr;
+                if (asm2orig.find(e, a)) 
+                    ctx.m_unsat_core.push_back(a);
+                else
+                    ctx.m_unsat_core.push_back(tr(e));
+            }
+            break;
+        }
+        default:
+            ctx.m_last_search_failure = pctx.m_last_search_failure;
+            break;
+        }
+        return result;
+    }
+
+}
@@ -0,0 +1,32 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    smt_parallel.h
+
+Abstract:
+
+    Parallel SMT, portfolio and cube-and-conquer.
+    Worker contexts are copies of the main context over
+    their own ast_manager. Each round, workers search with a
+    conflict budget, optionally under a cube literal chosen by
+    their case split heuristic. Units learned at base level are
+    exchanged between rounds. The first definitive answer wins.
+
+--*/
+#pragma once
+
+#include "smt/smt_context.h"
+
+namespace smt {
+
+    class parallel {
+        context& ctx;
+    public:
+        parallel(context& ctx): ctx(ctx) {}
+
+        lbool operator()(expr_ref_vector const& asms);
+    };
+
+}
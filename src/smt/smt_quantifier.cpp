@@ -134,6 +134,8 @@ namespace smt {
         ptr_vector<quantifier>                 m_quantifiers;
         scoped_ptr<quantifier_manager_plugin>  m_plugin;
         unsigned                               m_num_instances;
+        unsigned                               m_num_matches;
+        unsigned                               m_num_duplicate_matches;
 
         imp(quantifier_manager & wrapper, context & ctx, smt_params & p, quantifier_manager_plugin * plugin):
             m_wrapper(wrapper),
@@ -143,6 +145,8 @@ namespace smt {
             m_qstat_gen(ctx.get_manager(), ctx.get_region()),
             m_plugin(plugin) {
             m_num_instances = 0;
+            m_num_matches = 0;
+            m_num_duplicate_matches = 0;
             m_qi_queue.setup();
         }
 
@@ -179,6 +183,13 @@ namespace smt {
                 out.width(3);
                 out << max_generation << " : " << max_cost << "\n";
             }
+            if (s->get_num_matches() > 0) {
+                out << "[quantifier_matches] ";
+                out.width(10);
+                out << q->get_qid().str() << " : ";
+                out.width(6);
+                out << s->get_num_matches() << " : " << s->get_num_duplicate_matches() << "\n";
+            }
         }
 
         void del(quantifier * q) {
@@ -263,9 +274,16 @@ namespace smt {
             if (m_num_instances > m_params.m_qi_max_instances) {
                 return false;
             }
-            get_stat(q)->update_max_generation(max_generation);
+            quantifier_stat * stat = get_stat(q);
+            stat->update_max_generation(max_generation);
+            stat->inc_num_matches();
+            m_num_matches++;
             fingerprint * f = m_context.add_fingerprint(q, q->get_id(), num_bindings, bindings, def);
-            if (f) {
+            if (!f) {
+                stat->inc_num_duplicate_matches();
+                m_num_duplicate_matches++;
+            }
+            else {
                 if (has_trace_stream()) {
                     log_add_instance(f, q, pat, num_bindings, bindings, used_enodes);
                 }
@@ -512,9 +530,14 @@ namespace smt {
 
     void quantifier_manager::collect_statistics(::statistics & st) const {
         m_imp->m_qi_queue.collect_statistics(st);
+        st.update("quant matches", m_imp->m_num_matches);
+        st.update("quant duplicate matches", m_imp->m_num_duplicate_matches);
+        m_imp->m_plugin->collect_statistics(st);
     }
 
     void quantifier_manager::reset_statistics() {
+        m_imp->m_num_matches = 0;
+        m_imp->m_num_duplicate_matches = 0;
     }
 
     void quantifier_manager::display_stats(std::ostream & out, quantifier * q) const {
@@ -614,6 +637,12 @@ namespace smt {
             }
         }
 
+        void collect_statistics(::statistics & st) const override {
+            if (m_model_checker) {
+                m_model_checker->collect_statistics(st);
+            }
+        }
+
         void init_search_eh() override {
             m_lazy_matching_idx = 0;
             if (m_fparams->m_mbqi) {
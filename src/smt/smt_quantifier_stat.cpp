@@ -26,6 +26,8 @@ namespace smt {
         m_generation(generation),
         m_case_split_factor(1),
         m_num_nested_quantifiers(0),
+        m_num_matches(0),
+        m_num_duplicate_matches(0),
         m_num_instances(0),
         m_num_instances_curr_search(0),
         m_num_instances_curr_branch(0),
@@ -36,6 +36,8 @@ namespace smt {
         unsigned m_generation;
         unsigned m_case_split_factor; //!< the product of the size of the clauses created by this quantifier.
         unsigned m_num_nested_quantifiers;
+        unsigned m_num_matches;   //!< number of matches reported for this quantifier, including duplicates.
+        unsigned m_num_duplicate_matches; //!< matches rejected because the instance was already produced.
         unsigned m_num_instances;
         unsigned m_num_instances_curr_search;
         unsigned m_num_instances_curr_branch; //!< only updated if QI_TRACK_INSTANCES is true
@@ -67,6 +69,22 @@ namespace smt {
             return m_num_nested_quantifiers;
         }
 
+        unsigned get_num_matches() const {
+            return m_num_matches;
+        }
+
+        unsigned get_num_duplicate_matches() const {
+            return m_num_duplicate_matches;
+        }
+
+        void inc_num_matches() {
+            m_num_matches++;
+        }
+
+        void inc_num_duplicate_matches() {
+            m_num_duplicate_matches++;
+        }
+
         unsigned get_num_instances() const {
             return m_num_instances;
         }
@@ -21,6 +21,7 @@ Revision History:
 #include "ast/ast_pp.h"
 #include "ast/ast_ll_pp.h"
 #include "ast/ast_smt2_pp.h"
+#include "util/tptr.h"
 
 namespace smt {
 
@@ -48,21 +49,23 @@ namespace smt {
         rp.mark_as_relevant(m_target);
     }
 
-    class and_relevancy_eh : public relevancy_eh {
-        app * m_parent;
-    public:
-        and_relevancy_eh(app * p):m_parent(p) {}
-        ~and_relevancy_eh() override {}
-        void operator()(relevancy_propagator & rp) override;
+    /**
+       \brief The most frequent handlers are stored inline in the handler
+       and watch lists: the low bits of the relevancy_eh pointer encode the
+       kind of the handler, and the remaining bits its expression.
+       Untagged pointers are event handlers allocated in the region.
+    */
+    enum inline_eh_kind {
+        EH_CUSTOM = 0, // relevancy_eh object
+        EH_MARK   = 1, // mark the expression as relevant
+        EH_AND    = 2, // propagate relevancy of an and-application
+        EH_OR     = 3  // propagate relevancy of an or-application
     };
 
-    class or_relevancy_eh : public relevancy_eh {
-        app * m_parent;
-    public:
-        or_relevancy_eh(app * p):m_parent(p) {}
-        ~or_relevancy_eh() override {}
-        void operator()(relevancy_propagator & rp) override;
-    };
+    static relevancy_eh * mk_inline_eh(expr * n, inline_eh_kind k) {
+        SASSERT(GET_TAG(n) == 0);
+        return TAG(relevancy_eh *, n, k);
+    }
 
     class ite_relevancy_eh : public relevancy_eh {
         app * m_parent;
@@ -104,17 +107,17 @@ namespace smt {
         if (is_relevant(src))
             mark_as_relevant(target);
         else
-            add_handler(src, mk_relevancy_eh(simple_relevancy_eh(target)));
+            add_handler(src, mk_inline_eh(target, EH_MARK));
     }
 
     relevancy_eh * relevancy_propagator::mk_or_relevancy_eh(app * n) {
         SASSERT(get_manager().is_or(n));
-        return mk_relevancy_eh(or_relevancy_eh(n));
+        return mk_inline_eh(n, EH_OR);
     }
 
     relevancy_eh * relevancy_propagator::mk_and_relevancy_eh(app * n) {
         SASSERT(get_manager().is_and(n));
-        return mk_relevancy_eh(and_relevancy_eh(n));
+        return mk_inline_eh(n, EH_AND);
     }
     
     relevancy_eh * relevancy_propagator::mk_ite_relevancy_eh(app * n) {
@@ -149,6 +152,15 @@ namespace smt {
         };
         svector<scope>                 m_scopes;
         bool                           m_propagating;
+        struct stats {
+            unsigned m_num_marked;
+            unsigned m_num_propagations;
+            unsigned m_num_handlers;
+            unsigned m_num_watches;
+            void reset() { memset(this, 0, sizeof(*this)); }
+            stats() { reset(); }
+        };
+        stats                          m_stats;
 
         relevancy_propagator_imp(context & ctx):
             relevancy_propagator(ctx), m_qhead(0), m_relevant_exprs(ctx.get_manager()),
@@ -186,6 +198,48 @@ namespace smt {
                 m_watches[val ? 1 : 0].insert(n, ehs);
         }
 
+        void inline_eh(relevancy_eh * eh) {
+            expr * n = UNTAG(expr *, eh);
+            switch (GET_TAG(eh)) {
+            case EH_MARK:
+                mark_as_relevant(n);
+                break;
+            case EH_AND:
+                if (is_relevant_core(n))
+                    propagate_relevant_and(to_app(n));
+                break;
+            case EH_OR:
+                if (is_relevant_core(n))
+                    propagate_relevant_or(to_app(n));
+                break;
+            default:
+                UNREACHABLE();
+                break;
+            }
+        }
+
+        /**
+           \brief Invoke a handler installed by add_handler, n became relevant.
+        */
+        void handler_eh(relevancy_eh * eh, expr * n) {
+            m_stats.m_num_handlers++;
+            if (GET_TAG(eh) == EH_CUSTOM)
+                eh->operator()(*this, n);
+            else
+                inline_eh(eh);
+        }
+
+        /**
+           \brief Invoke a handler installed by add_watch, n was assigned to val.
+        */
+        void watch_eh(relevancy_eh * eh, expr * n, bool val) {
+            m_stats.m_num_watches++;
+            if (GET_TAG(eh) == EH_CUSTOM)
+                eh->operator()(*this, n, val);
+            else
+                inline_eh(eh);
+        }
+
         void push_trail(eh_trail const & t) {
             get_manager().inc_ref(t.get_node());
             m_trail.push_back(t);
@@ -195,7 +249,7 @@ namespace smt {
             if (!enabled())
                 return;
             if (is_relevant_core(source)) {
-                eh->operator()(*this, source);
+                handler_eh(eh, source);
             }
             else {
                 SASSERT(eh);
@@ -219,7 +273,7 @@ namespace smt {
                 push_trail(eh_trail(n, val));
                 break;
             case l_true:
-                eh->operator()(*this, n, val);
+                watch_eh(eh, n, val);
                 break;
             }
         }
@@ -234,7 +288,7 @@ namespace smt {
             case l_false:
                 return;
             case l_undef:
-                add_watch(n, val, mk_relevancy_eh(simple_relevancy_eh(target)));
+                add_watch(n, val, mk_inline_eh(target, EH_MARK));
                 break;
             case l_true:
                 mark_as_relevant(target); propagate();
@@ -303,6 +357,7 @@ namespace smt {
         }
 
         void set_relevant(expr * n) {
+            m_stats.m_num_marked++;
             m_is_relevant.insert(n->get_id());
             m_relevant_exprs.push_back(n);
             m_context.relevant_eh(n);
@@ -463,6 +518,7 @@ namespace smt {
                 TRACE("propagate_relevancy", tout << "marking as relevant:\n" << mk_bounded_pp(n, m) << "\n";);
                 SASSERT(is_relevant_core(n));
                 m_qhead++;
+                m_stats.m_num_propagations++;
                 if (is_app(n)) {
                     family_id fid = to_app(n)->get_family_id();
                     if (fid == m.get_basic_family_id()) {
@@ -488,7 +544,7 @@ namespace smt {
                 
                 relevancy_ehs * ehs = get_handlers(n);
                 while (ehs != nullptr) {
-                    ehs->head()->operator()(*this, n);
+                    handler_eh(ehs->head(), n);
                     ehs = ehs->tail();
                 }
             }
@@ -511,7 +567,7 @@ namespace smt {
             }
             relevancy_ehs * ehs = get_watches(n, val);
             while (ehs != nullptr) {
-                ehs->head()->operator()(*this, n, val);
+                watch_eh(ehs->head(), n, val);
                 ehs = ehs->tail();
             }
         }
@@ -526,6 +582,13 @@ namespace smt {
             }
         }
 
+        void collect_statistics(::statistics & st) const override {
+            st.update("relevancy marked", m_stats.m_num_marked);
+            st.update("relevancy propagations", m_stats.m_num_propagations);
+            st.update("relevancy handlers", m_stats.m_num_handlers);
+            st.update("relevancy watches", m_stats.m_num_watches);
+        }
+
 #ifdef Z3DEBUG
         bool check_relevancy_app(app * n) const  {
             SASSERT(is_relevant(n));
@@ -637,16 +700,6 @@ namespace smt {
 #endif
     };
 
-    void and_relevancy_eh::operator()(relevancy_propagator & rp) {
-        if (rp.is_relevant(m_parent))
-            static_cast<relevancy_propagator_imp&>(rp).propagate_relevant_and(m_parent);
-    }
-
-    void or_relevancy_eh::operator()(relevancy_propagator & rp) {
-        if (rp.is_relevant(m_parent))
-            static_cast<relevancy_propagator_imp&>(rp).propagate_relevant_or(m_parent);
-    }
-
     void ite_relevancy_eh::operator()(relevancy_propagator & rp) {
         if (rp.is_relevant(m_parent)) {
             static_cast<relevancy_propagator_imp&>(rp).propagate_relevant_ite(m_parent);
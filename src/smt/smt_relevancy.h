@@ -20,6 +20,7 @@ Revision History:
 #define SMT_RELEVANCY_H_
 
 #include "ast/ast.h"
+#include "util/statistics.h"
 
 namespace smt {
     class context;
@@ -156,6 +157,11 @@ namespace smt {
         */
         virtual void display(std::ostream & out) const = 0;
 
+        /**
+           \brief Report the amount of relevancy propagation work.
+        */
+        virtual void collect_statistics(::statistics & st) const {}
+
 #ifdef Z3DEBUG
         virtual bool check_relevancy(expr_ref_vector const & v) const = 0;
         virtual bool check_relevancy_or(app * n, bool root) const = 0;
@@ -189,7 +195,12 @@ namespace smt {
            as relevant.
         */
         void add_dependency(expr * src, expr * target);
-        
+
+        /**
+           \brief The handlers for and/or-applications are not allocated.
+           They are tagged pointers to the application, and must only be
+           passed to add_handler and add_watch.
+        */
         relevancy_eh * mk_or_relevancy_eh(app * n);
         relevancy_eh * mk_and_relevancy_eh(app * n);
         relevancy_eh * mk_ite_relevancy_eh(app * n);
@@ -33,6 +33,7 @@ Notes:
 #include <cmath>
 #include <condition_variable>
 #include "util/scoped_ptr_vector.h"
+#include "util/stopwatch.h"
 #include "ast/ast_util.h"
 #include "ast/ast_translation.h"
 #include "solver/solver.h"
@@ -331,6 +332,9 @@ private:
     bool          m_allsat;
     unsigned      m_num_unsat;
     unsigned      m_last_depth;
+    unsigned      m_num_cubes;        // cubes passed to a conquer solver
+    double        m_cube_time;        // total time spent solving cubes
+    double        m_max_cube_time;    // time of the hardest cube
     int           m_exn_code;
     std::string   m_exn_msg;
 
@@ -343,6 +347,9 @@ private:
         m_branches = 0;    
         m_num_unsat = 0;
         m_last_depth = 0;
+        m_num_cubes = 0;
+        m_cube_time = 0;
+        m_max_cube_time = 0;
         m_backtrack_frequency = pp.conquer_backtrack_frequency();
         m_conquer_delay = pp.conquer_delay();
         m_exn_code = 0;
@@ -429,6 +436,16 @@ private:
         }
     }
         
+    void report_cube_time(expr_ref_vector const& cube, lbool status, double secs) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            ++m_num_cubes;
+            m_cube_time += secs;
+            m_max_cube_time = std::max(m_max_cube_time, secs);
+        }
+        IF_VERBOSE(2, verbose_stream() << "(tactic.parallel :cube-time " << secs << " :size " << cube.size() << " :status " << status << ")\n";);
+    }
+
     void report_undef(solver_state& s) {
         m_has_undef = true;
         close_branch(s, l_undef);
@@ -488,7 +505,11 @@ private:
                 s.set_conquer_params(*conquer.get());
             }
             if (conquer) {
+                stopwatch sw;
+                sw.start();
                 is_sat = conquer->check_sat(c);
+                sw.stop();
+                report_cube_time(c, is_sat, sw.get_seconds());
             }
             switch (is_sat) {
             case l_false: 
@@ -748,6 +769,9 @@ public:
         st.update("par unsat", m_num_unsat);
         st.update("par models", m_models.size());
         st.update("par progress", m_progress);
+        st.update("par cubes", m_num_cubes);
+        st.update("par cube time", m_cube_time);
+        st.update("par cube max time", m_max_cube_time);
     }
 
     void reset_statistics() override {
@@ -0,0 +1,134 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    cg_table.cpp
+
+Abstract:
+
+    Micro-benchmark for congruence closure in smt::context.
+    Builds a synthetic EUF workload over chains of unary and
+    binary applications, merges the constants of the chain,
+    and reports merges per second. Before that, it checks that
+    applications of a commutative symbol are congruent up to the
+    order of their arguments.
+
+--*/
+#include "smt/smt_context.h"
+#include "ast/reg_decl_plugins.h"
+#include "util/statistics.h"
+#include "util/stopwatch.h"
+#include <cstring>
+
+static unsigned num_merges(smt::context const& ctx) {
+    statistics st;
+    ctx.collect_statistics(st);
+    for (unsigned i = 0; i < st.size(); ++i) {
+        if (st.is_uint(i) && strcmp(st.get_key(i), "added eqs") == 0) {
+            return st.get_uint_value(i);
+        }
+    }
+    return 0;
+}
+
+static void tst_commutative_congruence() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt_params params;
+    smt::context ctx(m, params);
+
+    sort_ref s(m.mk_uninterpreted_sort(symbol("S")), m);
+    sort * ss[2] = { s, s };
+    func_decl_info info(null_family_id, null_decl_kind);
+    info.set_commutative();
+    func_decl_ref h(m.mk_func_decl(symbol("h"), 2, ss, s, info), m);
+
+    // many distinct argument roots, so the commutative table does not
+    // only succeed by hash collisions.
+    unsigned n = 200;
+    app_ref_vector as(m), t1(m), t2(m);
+    for (unsigned j = 0; j < n; ++j) {
+        as.push_back(m.mk_fresh_const("a", s));
+    }
+    app_ref c(m.mk_fresh_const("c", s), m);
+    for (unsigned j = 0; j + 1 < n; ++j) {
+        t1.push_back(m.mk_app(h, as.get(j), as.get(j + 1)));
+        t2.push_back(m.mk_app(h, as.get(j + 1), as.get(j)));
+        ctx.assert_expr(m.mk_not(m.mk_eq(t1.get(j), c)));
+        ctx.assert_expr(m.mk_not(m.mk_eq(t2.get(j), c)));
+    }
+    VERIFY(ctx.check() == l_true);
+    for (unsigned j = 0; j + 1 < n; ++j) {
+        ENSURE(ctx.get_enode(t1.get(j))->get_root() == ctx.get_enode(t2.get(j))->get_root());
+    }
+
+    // h(a0, a1) and h(a2, a0) become congruent once a1 = a2.
+    app_ref t3(m.mk_app(h, as.get(2), as.get(0)), m);
+    ctx.push();
+    ctx.assert_expr(m.mk_eq(as.get(1), as.get(2)));
+    ctx.assert_expr(m.mk_not(m.mk_eq(t1.get(0), t3)));
+    ENSURE(ctx.check() == l_false);
+    ctx.pop(1);
+
+    ctx.push();
+    ctx.assert_expr(m.mk_not(m.mk_eq(t1.get(0), t3)));
+    ENSURE(ctx.check() == l_true);
+    ctx.pop(1);
+}
+
+void tst_cg_table(char ** argv, int argc, int& i) {
+    tst_commutative_congruence();
+    unsigned n = 500, rounds = 20;
+    if (argc == i + 2) {
+        n = atoi(argv[i + 1]);
+        ++i;
+    }
+
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt_params params;
+    smt::context ctx(m, params);
+
+    sort_ref s(m.mk_uninterpreted_sort(symbol("S")), m);
+    sort * ss[2] = { s, s };
+    func_decl_ref f(m.mk_func_decl(symbol("f"), 1, ss, s), m);
+    func_decl_ref g(m.mk_func_decl(symbol("g"), 2, ss, s), m);
+
+    // a_i, f(a_i), f(f(a_i)) and g(a_i, f(a_{i+1})) for every i.
+    app_ref_vector as(m), terms(m);
+    for (unsigned j = 0; j < n; ++j) {
+        as.push_back(m.mk_fresh_const("a", s));
+    }
+    for (unsigned j = 0; j + 1 < n; ++j) {
+        app_ref fa(m.mk_app(f, as.get(j)), m);
+        terms.push_back(m.mk_app(f, fa.get()));
+        terms.push_back(m.mk_app(g, as.get(j), m.mk_app(f, as.get(j + 1))));
+    }
+    // the terms are internalized once and merged by congruence in every round.
+    app_ref c(m.mk_fresh_const("c", s), m);
+    for (app * t : terms) {
+        ctx.assert_expr(m.mk_not(m.mk_eq(t, c)));
+    }
+
+    stopwatch sw;
+    sw.start();
+    unsigned merges = num_merges(ctx);
+    for (unsigned r = 0; r < rounds; ++r) {
+        ctx.push();
+        for (unsigned j = 0; j + 1 < n; ++j) {
+            ctx.assert_expr(m.mk_eq(as.get(j), as.get(j + 1)));
+        }
+        lbool is_sat = ctx.check();
+        VERIFY(is_sat == l_true);
+        ctx.pop(1);
+    }
+    sw.stop();
+    merges = num_merges(ctx) - merges;
+    double secs = sw.get_seconds();
+    std::cout << "merges:        " << merges << "\n";
+    std::cout << "seconds:       " << secs << "\n";
+    if (secs > 0) {
+        std::cout << "merges/sec:    " << (merges / secs) << "\n";
+    }
+}
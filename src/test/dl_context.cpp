@@ -10,12 +10,63 @@ Copyright (c) 2015 Microsoft Corporation
 #include "muz/base/dl_context.h"
 #include "smt/params/smt_params.h"
 #include "muz/fp/dl_register_engine.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/bv_decl_plugin.h"
 
 using namespace datalog;
 
+/**
+   \brief Repeated queries reuse the rules simplified by the interpreted
+   tail simplifier, and the cache does not grow beyond the rule set.
+*/
+static void tst_simplified_rules_cache() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    bv_util bv(m);
+    register_engine re;
+    smt_params fparams;
+    context ctx(m, re, fparams);
+    params_ref params;
+    params.set_sym("engine", symbol("spacer"));
+    ctx.updt_params(params);
+
+    sort_ref s(bv.mk_sort(4), m);
+    sort* ss[2] = { s, s };
+    func_decl_ref p(m.mk_func_decl(symbol("p"), 1, ss, m.mk_bool_sort()), m);
+    func_decl_ref q(m.mk_func_decl(symbol("q"), 1, ss, m.mk_bool_sort()), m);
+    func_decl_ref r(m.mk_func_decl(symbol("r"), 2, ss, m.mk_bool_sort()), m);
+    ctx.register_predicate(p, false);
+    ctx.register_predicate(q, false);
+    ctx.register_predicate(r, false);
+
+    symbol names[2] = { symbol("x"), symbol("y") };
+    expr_ref x(m.mk_var(0, s), m), y(m.mk_var(1, s), m);
+    expr_ref one(bv.mk_numeral(1, 4), m), three(bv.mk_numeral(3, 4), m);
+    // p(1). q(x) :- p(x), x != 3, x = x. r(x, y) :- q(x), y = x + 1, not (y = 3).
+    ctx.add_fact(to_app(m.mk_app(p, one.get())));
+    expr_ref body(m), fml(m);
+    body = m.mk_and(m.mk_app(p, x.get()), m.mk_not(m.mk_eq(x, three)), m.mk_eq(x, x));
+    fml = m.mk_forall(1, ss, names, m.mk_implies(body, m.mk_app(q, x.get())));
+    ctx.add_rule(fml, symbol("q"));
+    body = m.mk_and(m.mk_app(q, x.get()), m.mk_eq(y, bv.mk_bv_add(x, one)), m.mk_not(m.mk_eq(y, three)));
+    fml = m.mk_forall(2, ss, names, m.mk_implies(body, m.mk_app(r, x.get(), y.get())));
+    ctx.add_rule(fml, symbol("r"));
+
+    for (unsigned i = 0; i < 3; ++i) {
+        unsigned hits = ctx.get_simplified_rules_hits();
+        expr_ref qr(m.mk_app(r, one.get(), bv.mk_numeral(2, 4)), m);
+        VERIFY(ctx.query(qr) == l_true);
+        ENSURE(ctx.get_num_simplified_rules() <= ctx.get_rules().get_num_rules());
+        ENSURE(i == 0 || ctx.get_simplified_rules_hits() > hits);
+    }
+    ctx.reset_statistics();
+    ENSURE(ctx.get_simplified_rules_hits() == 0);
+}
 
 void tst_dl_context() {
 
+    tst_simplified_rules_cache();
+
     return;
 
 #if 0
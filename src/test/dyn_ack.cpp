@@ -0,0 +1,51 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    dyn_ack.cpp
+
+Abstract:
+
+    Test the count-min sketch that filters dynamic Ackermann candidates.
+
+--*/
+#include "smt/smt_context.h"
+#include "smt/dyn_ack.h"
+#include "ast/reg_decl_plugins.h"
+
+void tst_dyn_ack() {
+    ast_manager m;
+    reg_decl_plugins(m);
+    smt_params params;
+    params.m_dack = DACK_CR;
+    smt::context ctx(m, params);
+    smt::dyn_ack_manager dack(ctx, params);
+
+    sort_ref s(m.mk_uninterpreted_sort(symbol("S")), m);
+    sort * ss[1] = { s };
+    func_decl_ref f(m.mk_func_decl(symbol("f"), 1, ss, s), m);
+    app_ref_vector fs(m);
+    unsigned n = 50000;
+    for (unsigned i = 0; i < n; ++i) {
+        fs.push_back(m.mk_app(f, m.mk_fresh_const("a", s)));
+    }
+
+    // many more distinct pairs than counters in the sketch, each used once or twice.
+    unsigned num_events = 0;
+    for (unsigned k = 1; k <= 4; ++k) {
+        for (unsigned i = 0; i + k < n; ++i) {
+            dack.used_cg_eh(fs.get(i), fs.get(i + k));
+            ++num_events;
+        }
+    }
+    ENSURE(dack.get_num_misses() > 0);
+    ENSURE(dack.get_num_tracked() < num_events / 100);
+
+    // a pair that is used repeatedly is tracked exactly.
+    unsigned num_tracked = dack.get_num_tracked();
+    for (unsigned i = 0; i < 2 * params.m_dack_threshold; ++i) {
+        dack.used_cg_eh(fs.get(0), fs.get(n - 1));
+    }
+    ENSURE(dack.get_num_tracked() == num_tracked + 1);
+}
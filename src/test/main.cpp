@@ -197,6 +197,10 @@ int main(int argc, char ** argv) {
     TST(arith_rewriter);
     TST(check_assumptions);
     TST(smt_context);
+    TST(dyn_ack);
+    TST(smt_parallel);
+    TST(smt_model_checker);
+    TST_ARGV(cg_table);
     TST(theory_dl);
     TST(model_retrieval);
     TST(model_based_opt);
@@ -209,6 +213,7 @@ int main(int argc, char ** argv) {
     TST(prime_generator);
     TST(permutation);
     TST(nlsat);
+    TST(sat_vivify);
     if (test_all) return 0;
     TST(ext_numeral);
     TST(interval);
@@ -245,6 +250,7 @@ int main(int argc, char ** argv) {
     TST(get_consequences);
     TST(pb2bv);
     TST_ARGV(sat_lookahead);
+    TST_ARGV(sat_propagate);
     TST_ARGV(sat_local_search);
     TST_ARGV(cnf_backbones);
     TST(bdd);
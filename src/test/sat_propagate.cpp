@@ -0,0 +1,141 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    sat_propagate.cpp
+
+Abstract:
+
+    Micro-benchmark for unit propagation throughput of sat::solver.
+    Runs the CDCL search for a bounded number of conflicts on a
+    DIMACS file or on a random k-SAT instance and reports
+    propagations per second. Before that, the results on small
+    random instances are checked against exhaustive enumeration.
+
+--*/
+#include "sat/sat_solver.h"
+#include "sat/dimacs.h"
+#include "util/statistics.h"
+#include "util/stopwatch.h"
+#include "util/util.h"
+#include <cstring>
+#include <functional>
+
+typedef vector<sat::literal_vector> clause_vector_t;
+
+static void mk_random_instance(sat::solver& solver, unsigned num_vars, unsigned num_clauses, unsigned k, random_gen& r, clause_vector_t& clauses) {
+    for (unsigned v = 0; v < num_vars; ++v) {
+        solver.mk_var();
+    }
+    sat::literal_vector lits;
+    for (unsigned i = 0; i < num_clauses; ++i) {
+        lits.reset();
+        while (lits.size() < k) {
+            sat::literal lit(r(num_vars), r(2) == 0);
+            bool found = false;
+            for (sat::literal l : lits) {
+                found |= l.var() == lit.var();
+            }
+            if (!found) lits.push_back(lit);
+        }
+        solver.mk_clause(lits);
+        clauses.push_back(lits);
+    }
+}
+
+static bool is_satisfied(clause_vector_t const& clauses, std::function<bool(sat::literal)> const& is_true) {
+    for (sat::literal_vector const& c : clauses) {
+        bool sat = false;
+        for (sat::literal l : c) {
+            sat |= is_true(l);
+        }
+        if (!sat) return false;
+    }
+    return true;
+}
+
+static lbool brute_force(unsigned num_vars, clause_vector_t const& clauses) {
+    for (unsigned mask = 0; mask < (1u << num_vars); ++mask) {
+        if (is_satisfied(clauses, [&](sat::literal l) { return (((mask >> l.var()) & 1) != 0) != l.sign(); })) {
+            return l_true;
+        }
+    }
+    return l_false;
+}
+
+// long clauses close to the threshold, so that both results occur
+// and watches of satisfied clauses are exercised.
+static void tst_random_results() {
+    random_gen r(0);
+    unsigned num_sat = 0, num_unsat = 0;
+    for (unsigned i = 0; i < 40; ++i) {
+        reslimit limit;
+        params_ref params;
+        sat::solver solver(params, limit);
+        clause_vector_t clauses;
+        unsigned num_vars = 14;
+        mk_random_instance(solver, num_vars, 21 * num_vars, 5, r, clauses);
+        lbool is_sat = solver.check();
+        ENSURE(is_sat == brute_force(num_vars, clauses));
+        if (is_sat == l_true) {
+            ++num_sat;
+            sat::model const& mdl = solver.get_model();
+            ENSURE(is_satisfied(clauses, [&](sat::literal l) { return value_at(l, mdl) == l_true; }));
+        }
+        else {
+            ++num_unsat;
+        }
+    }
+    ENSURE(num_sat > 0 && num_unsat > 0);
+}
+
+static double num_propagations(sat::solver const& solver) {
+    statistics st;
+    solver.collect_statistics(st);
+    double result = 0;
+    for (unsigned i = 0; i < st.size(); ++i) {
+        if (st.is_uint(i) && strncmp(st.get_key(i), "sat propagations", 16) == 0) {
+            result += st.get_uint_value(i);
+        }
+    }
+    return result;
+}
+
+void tst_sat_propagate(char ** argv, int argc, int& i) {
+    tst_random_results();
+    reslimit limit;
+    params_ref params;
+    params.set_uint("max_conflicts", 20000);
+    sat::solver solver(params, limit);
+    if (argc == i + 2) {
+        char const* file_name = argv[i + 1];
+        ++i;
+        std::ifstream in(file_name);
+        if (in.bad() || in.fail()) {
+            std::cerr << "(error \"failed to open file '" << file_name << "'\")" << std::endl;
+            exit(ERR_OPEN_FILE);
+        }
+        if (!parse_dimacs(in, std::cerr, solver))
+            return;
+    }
+    else {
+        // random 5-SAT close to the threshold: long clauses exercise blocker literals.
+        random_gen r(0);
+        clause_vector_t clauses;
+        mk_random_instance(solver, 300, 6000, 5, r, clauses);
+    }
+
+    stopwatch sw;
+    sw.start();
+    lbool is_sat = solver.check();
+    sw.stop();
+    double props = num_propagations(solver);
+    double secs = sw.get_seconds();
+    std::cout << "result:       " << is_sat << "\n";
+    std::cout << "propagations: " << props << "\n";
+    std::cout << "seconds:      " << secs << "\n";
+    if (secs > 0) {
+        std::cout << "props/sec:    " << (props / secs) << "\n";
+    }
+}
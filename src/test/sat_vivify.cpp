@@ -0,0 +1,52 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    sat_vivify.cpp
+
+Abstract:
+
+    Test vivification of learned clauses.
+
+--*/
+#include "sat/sat_solver.h"
+#include "sat/sat_vivify.h"
+#include "util/util.h"
+
+static bool contains(sat::clause const& c, sat::literal l) {
+    for (sat::literal l2 : c) {
+        if (l2 == l) return true;
+    }
+    return false;
+}
+
+void tst_sat_vivify() {
+    reslimit limit;
+    params_ref params;
+    params.set_uint("vivify.delay", 0);
+    sat::solver s(params, limit);
+    for (unsigned i = 0; i < 6; ++i) {
+        s.mk_var();
+    }
+    sat::literal a(0, false), b(1, false), c(2, false), d(3, false), e(4, false), f(5, false);
+    // a => b => c
+    s.mk_clause(~a, b);
+    s.mk_clause(~b, c);
+    // a implies c, so vivification shortens d \/ ~a \/ c \/ e \/ f to d \/ ~a \/ c.
+    sat::literal lits[5] = { d, ~a, c, e, f };
+    s.mk_clause(5, lits, true);
+    ENSURE(s.learned().size() == 1);
+
+    sat::vivify vivify(s, params);
+    vivify();
+    ENSURE(s.learned().size() == 1);
+    sat::clause const& cls = *s.learned()[0];
+    ENSURE(cls.size() == 3);
+    ENSURE(contains(cls, d) && contains(cls, ~a) && contains(cls, c));
+
+    ENSURE(s.check() == l_true);
+    sat::model const& mdl = s.get_model();
+    ENSURE(value_at(~a, mdl) == l_true || value_at(b, mdl) == l_true);
+    ENSURE(value_at(~b, mdl) == l_true || value_at(c, mdl) == l_true);
+}
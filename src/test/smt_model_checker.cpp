@@ -0,0 +1,83 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    smt_model_checker.cpp
+
+Abstract:
+
+    Test the cache of quantifier bodies proved valid by the
+    model checker across incremental checks.
+
+--*/
+#include <cstring>
+#include "smt/smt_context.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/arith_decl_plugin.h"
+
+static unsigned get_uint_stat(smt::context const& ctx, char const* key) {
+    statistics st;
+    ctx.collect_statistics(st);
+    for (unsigned i = 0; i < st.size(); ++i) {
+        if (st.is_uint(i) && strcmp(st.get_key(i), key) == 0) {
+            return st.get_uint_value(i);
+        }
+    }
+    return 0;
+}
+
+/**
+   \brief Run a sequence of incremental checks over
+   forall x. f(x) >= 0 and forall x. p(x) => g(x) > x.
+   Return the number of cached model checks.
+*/
+static unsigned run(bool use_cache, svector<lbool>& results) {
+    ast_manager m;
+    reg_decl_plugins(m);
+    arith_util a(m);
+    smt_params params;
+    params.m_mbqi_cache = use_cache;
+    smt::context ctx(m, params);
+
+    sort_ref I(a.mk_int(), m);
+    sort * ss[1] = { I };
+    func_decl_ref f(m.mk_func_decl(symbol("f"), 1, ss, I), m);
+    func_decl_ref g(m.mk_func_decl(symbol("g"), 1, ss, I), m);
+    func_decl_ref p(m.mk_func_decl(symbol("p"), 1, ss, m.mk_bool_sort()), m);
+    expr_ref ca(m.mk_const(symbol("a"), I), m), cb(m.mk_const(symbol("b"), I), m);
+    expr_ref x(m.mk_var(0, I), m);
+    symbol names[1] = { symbol("x") };
+    expr_ref q1(m.mk_forall(1, ss, names, a.mk_ge(m.mk_app(f, x.get()), a.mk_int(0))), m);
+    expr_ref q2(m.mk_forall(1, ss, names, m.mk_implies(m.mk_app(p, x.get()), a.mk_gt(m.mk_app(g, x.get()), x))), m);
+    ctx.assert_expr(q1);
+    ctx.assert_expr(q2);
+    ctx.assert_expr(m.mk_app(p, ca.get()));
+
+    expr_ref_vector steps(m);
+    steps.push_back(a.mk_gt(m.mk_app(f, ca.get()), a.mk_int(3)));
+    steps.push_back(a.mk_gt(m.mk_app(g, cb.get()), a.mk_int(7)));
+    steps.push_back(m.mk_and(a.mk_lt(m.mk_app(f, cb.get()), a.mk_int(2)), m.mk_app(p, cb.get())));
+    steps.push_back(m.mk_and(m.mk_app(p, cb.get()), a.mk_lt(m.mk_app(g, cb.get()), cb)));
+    steps.push_back(a.mk_lt(m.mk_app(f, m.mk_app(g, ca.get())), a.mk_int(0)));
+    for (expr* s : steps) {
+        ctx.push();
+        ctx.assert_expr(s);
+        results.push_back(ctx.check());
+        ctx.pop(1);
+    }
+    ctx.assert_expr(m.mk_eq(ca, cb));
+    results.push_back(ctx.check());
+    return get_uint_stat(ctx, "mbqi cached checks");
+}
+
+void tst_smt_model_checker() {
+    svector<lbool> r1, r2;
+    unsigned cached = run(true, r1);
+    unsigned uncached = run(false, r2);
+    ENSURE(cached > 0);
+    ENSURE(uncached == 0);
+    ENSURE(r1 == r2);
+    ENSURE(r1[0] == l_true && r1[1] == l_true && r1[2] == l_true);
+    ENSURE(r1[3] == l_false && r1[4] == l_false && r1[5] == l_true);
+}
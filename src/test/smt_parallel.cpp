@@ -0,0 +1,148 @@
+/*++
+Copyright (c) 2019 Microsoft Corporation
+
+Module Name:
+
+    smt_parallel.cpp
+
+Abstract:
+
+    Test parallel SMT (smt.threads > 1) on pigeonhole instances over
+    uninterpreted sorts and integers, with assumptions and push/pop,
+    and its sequential fallbacks.
+
+--*/
+#include <cstdio>
+#include <fstream>
+#include "smt/smt_context.h"
+#include "ast/reg_decl_plugins.h"
+#include "ast/arith_decl_plugin.h"
+#include "model/model.h"
+
+/**
+   \brief Pigeon i is placed in one of the holes if guards[i] holds,
+   and no two pigeons share a hole.
+*/
+static void mk_pigeonhole(ast_manager& m, bool use_lia, unsigned num_pigeons, unsigned num_holes,
+                          expr_ref_vector& fmls, expr_ref_vector& guards) {
+    arith_util a(m);
+    sort_ref s(use_lia ? a.mk_int() : m.mk_uninterpreted_sort(symbol("S")), m);
+    expr_ref_vector holes(m), pigeons(m);
+    for (unsigned j = 0; j < num_holes; ++j) {
+        holes.push_back(use_lia ? a.mk_int(j) : m.mk_const(symbol(("h" + std::to_string(j)).c_str()), s));
+    }
+    for (unsigned i = 0; i < num_pigeons; ++i) {
+        expr_ref p(m.mk_const(symbol(("p" + std::to_string(i)).c_str()), s), m);
+        expr_ref g(m.mk_const(symbol(("g" + std::to_string(i)).c_str()), m.mk_bool_sort()), m);
+        expr_ref_vector places(m);
+        for (expr* h : holes) {
+            places.push_back(m.mk_eq(p, h));
+        }
+        fmls.push_back(m.mk_implies(g, m.mk_or(places.size(), places.c_ptr())));
+        pigeons.push_back(p);
+        guards.push_back(g);
+    }
+    fmls.push_back(m.mk_distinct(pigeons.size(), pigeons.c_ptr()));
+}
+
+static void check(smt::context& ctx, expr_ref_vector const& fmls, expr_ref_vector const& asms, lbool expected) {
+    lbool r = ctx.check(asms.size(), asms.c_ptr());
+    ENSURE(r == expected);
+    if (r == l_true) {
+        model_ref mdl;
+        ctx.get_model(mdl);
+        ENSURE(mdl);
+        for (expr* e : fmls) ENSURE(mdl->is_true(e));
+        for (expr* e : asms) ENSURE(mdl->is_true(e));
+    }
+    else if (r == l_false) {
+        ENSURE(ctx.get_unsat_core_size() > 0);
+        for (unsigned i = 0; i < ctx.get_unsat_core_size(); ++i) {
+            ENSURE(asms.contains(ctx.get_unsat_core_expr(i)));
+        }
+    }
+}
+
+static void tst_pigeonhole(ast_manager& m, bool use_lia) {
+    smt_params params;
+    params.m_threads = 4;
+    params.m_threads_max_conflicts = 2;
+    expr_ref_vector fmls(m), guards(m);
+    mk_pigeonhole(m, use_lia, 6, 5, fmls, guards);
+    smt::context ctx(m, params);
+    for (expr* e : fmls) ctx.assert_expr(e);
+
+    // all pigeons are placed: unsat, the core consists of guards.
+    check(ctx, fmls, guards, l_false);
+
+    // one pigeon is free: sat.
+    expr_ref_vector asms(m);
+    asms.append(guards.size() - 1, guards.c_ptr());
+    check(ctx, fmls, asms, l_true);
+
+    // searches above base level fall back to the sequential solver.
+    ctx.push();
+    ctx.assert_expr(guards.get(0));
+    fmls.push_back(guards.get(0));
+    asms.reset();
+    asms.append(guards.size() - 2, guards.c_ptr() + 1);
+    check(ctx, fmls, asms, l_true);
+    asms.push_back(guards.back());
+    check(ctx, fmls, asms, l_false);
+    ctx.pop(1);
+    fmls.pop_back();
+
+    check(ctx, fmls, guards, l_false);
+    asms.reset();
+    asms.append(guards.size() - 1, guards.c_ptr() + 1);
+    check(ctx, fmls, asms, l_true);
+}
+
+// the search without assumptions goes through setup_and_check.
+static void tst_setup_and_check(ast_manager& m, bool use_lia, unsigned num_pigeons, lbool expected) {
+    smt_params params;
+    params.m_threads = 4;
+    params.m_threads_max_conflicts = 2;
+    expr_ref_vector fmls(m), guards(m);
+    mk_pigeonhole(m, use_lia, num_pigeons, 5, fmls, guards);
+    fmls.append(guards);
+    smt::context ctx(m, params);
+    for (expr* e : fmls) ctx.assert_expr(e);
+    lbool r = ctx.setup_and_check();
+    ENSURE(r == expected);
+    if (r == l_true) {
+        model_ref mdl;
+        ctx.get_model(mdl);
+        ENSURE(mdl);
+        for (expr* e : fmls) ENSURE(mdl->is_true(e));
+    }
+}
+
+void tst_smt_parallel() {
+    for (unsigned i = 0; i < 2; ++i) {
+        bool use_lia = i == 1;
+        ast_manager m;
+        reg_decl_plugins(m);
+        tst_pigeonhole(m, use_lia);
+        tst_setup_and_check(m, use_lia, 5, l_true);
+        tst_setup_and_check(m, use_lia, 6, l_false);
+    }
+
+    // proofs and the trace stream keep the search sequential.
+    {
+        ast_manager m(PGM_ENABLED);
+        reg_decl_plugins(m);
+        tst_pigeonhole(m, false);
+    }
+    {
+        char const* file_name = "smt_parallel_trace.log";
+        std::fstream trace(file_name, std::ios_base::out);
+        {
+            ast_manager m(PGM_DISABLED, &trace);
+            reg_decl_plugins(m);
+            tst_pigeonhole(m, true);
+        }
+        trace.close();
+        std::remove(file_name);
+    }
+}
@@ -5,6 +5,7 @@ Copyright (c) 2015 Microsoft Corporation
 --*/
 
 #include "muz/rel/tbv.h"
+#include "util/util.h"
 
 static void tst1(unsigned num_bits) {
     tbv_manager m(num_bits);
@@ -74,6 +75,37 @@ static void tst2(unsigned num_bits) {
     }
 }
 
+static void tst3(unsigned num_bits) {
+    tbv_manager m(num_bits);
+    tbv_ref a(m), b(m), c(m), d(m);
+    random_gen r(0);
+    for (unsigned k = 0; k < 100; ++k) {
+        a = m.allocateX();
+        b = m.allocateX();
+        c = m.allocate();
+        for (unsigned i = 0; i < num_bits; ++i) {
+            if (r(3) == 0) m.set(*a, i, r(2) ? BIT_1 : BIT_0);
+            if (r(3) == 0) m.set(*b, i, r(2) ? BIT_1 : BIT_0);
+        }
+        bool ok = m.intersect(*a, *b, *c);
+        d = m.allocate(*a);
+        VERIFY(ok == m.set_and(*d, *b));
+        ENSURE(m.equals(*c, *d));
+        ENSURE(ok == m.is_well_formed(*c));
+        ptr_vector<tbv> neg;
+        m.complement(*a, neg);
+        unsigned num_fixed = 0;
+        for (unsigned i = 0; i < num_bits; ++i) {
+            if ((*a)[i] != BIT_x) ++num_fixed;
+        }
+        ENSURE(neg.size() == num_fixed);
+        for (tbv* n : neg) {
+            ENSURE(!m.intersect(*a, *n, *c));
+            m.deallocate(n);
+        }
+    }
+}
+
 void tst_tbv() {
     tst0();
     
@@ -88,4 +120,9 @@ void tst_tbv() {
     tst2(15);
     tst2(16);
     tst2(17);
+
+    tst3(11);
+    tst3(16);
+    tst3(33);
+    tst3(70);
 }